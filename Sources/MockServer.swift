@@ -7,6 +7,10 @@
 
 import Foundation
 
+#if canImport(FoundationNetworking)
+import FoundationNetworking
+#endif
+
 #if SWIFT_PACKAGE
 import PactMockServer
 #endif
@@ -23,6 +27,24 @@ public class MockServer {
         case tlsConfigFailure
     }
 
+    /// Configures how long a mock server has to be idle before it is considered quiescent.
+    public struct Quiescence: Sendable {
+
+        /// The time without any new request activity after which the mock server is considered quiescent.
+        public let idleWindow: TimeInterval
+
+        /// The maximum time to wait for the mock server to become quiescent.
+        public let timeout: TimeInterval
+
+        /// - Parameters:
+        ///   - idleWindow: The time without any new request activity after which the mock server is considered quiescent.
+        ///   - timeout: The maximum time to wait for the mock server to become quiescent.
+        public init(idleWindow: TimeInterval = 0.1, timeout: TimeInterval = 5) {
+            self.idleWindow = idleWindow
+            self.timeout = timeout
+        }
+    }
+
     /// Network transfer protocol
     public enum TransferProtocol: Int {
         case standard
@@ -52,6 +74,9 @@ public class MockServer {
     private let pact: Pact
     private let transferProtocol: TransferProtocol
     private let ffiProvider: PactFFIProviding
+    private let certificateAuthority: TLSCertificateAuthority
+    private let lifecycleLock = NSLock()
+    private var isShutDown = false
 
     // `port` is a var to support Linux platforms
     public private(set) var port: Int32 = 0
@@ -66,26 +91,37 @@ public class MockServer {
     ///   - transferProtocol: The protocol to use when communicating with the mock server; defaults to `.standard`.
     ///   - port: The port on which to run mock server; use `nil` for a random port.
     convenience public init(pact: Pact, transferProtocol: TransferProtocol = .standard, port: Int32? = nil) throws {
-        try self.init(pact: pact, transferProtocol: transferProtocol, port: port, ffiProvider: DefaultPactFFIProvider())
+        try self.init(
+            pact: pact,
+            transferProtocol: transferProtocol,
+            port: port,
+            ffiProvider: DefaultPactFFIProvider(),
+            certificateAuthority: .shared
+        )
     }
 
     /// Fetch the CA Certificate used to generate the self-signed certificate for the TLS mock server.
+    ///
+    /// The certificate is fetched once and shared by every mock server in the process.
     public var tlsCACertificate: String? {
-        guard let cert = ffiProvider.tlsCACertificate() else {
-            return nil
-        }
-        defer { ffiProvider.stringRelease(cert: cert) }
+        certificateAuthority.pem
+    }
 
-        return cert
+    #if canImport(Security)
+    /// A `URLSession` shared by every mock server that trusts the CA certificate of the TLS mock servers.
+    ///
+    /// Connections and TLS sessions are kept alive across tests, so requests to a `.secure` mock server
+    /// don't each pay for a full handshake and trust evaluation.
+    ///
+    /// - Note: Only available on Apple platforms, where the Security framework can anchor trust on the CA.
+    ///
+    public var urlSession: URLSession {
+        certificateAuthority.urlSession
     }
+    #endif
 
     deinit {
-        if port != 0 {
-            Logging.log(.debug, message: "Shutting down mock server on port \(port)...")
-            if ffiProvider.mockServerCleanup(port: port) == false {
-                Logging.log(.debug, message: "Failed to shut down mock server!")
-            }
-        }
+        stop()
     }
 
     // MARK: - Internal
@@ -97,17 +133,21 @@ public class MockServer {
     ///   - transferProtocol: The protocol to use when communicating with the mock server; defaults to `.standard`.
     ///   - port: The port on which to run mock server; use `nil` for a random port.
     ///   - ffiProvider: The implementation or a wrapper for Pact FFI provider.
+    ///   - certificateAuthority: The TLS certificate authority to share; `nil` uses one backed by `ffiProvider`.
     internal init(
         pact: Pact,
         transferProtocol: TransferProtocol = .standard,
         port: Int32? = nil,
-        ffiProvider: PactFFIProviding
+        ffiProvider: PactFFIProviding,
+        certificateAuthority: TLSCertificateAuthority? = nil
     ) throws {
         self.ffiProvider = ffiProvider
         self.transferProtocol = transferProtocol
         self.pact = pact
+        self.certificateAuthority = certificateAuthority ?? TLSCertificateAuthority(ffiProvider: ffiProvider)
 
-        let tryPort = port ?? Self.randomPort
+        // `0` has the OS allocate an available port when the mock server binds it
+        let tryPort = port ?? 0
         Logging.log(.debug, message: "Starting mock server on \(socketAddress):\(tryPort)...")
 
         let result = try ffiProvider.mockServerForTransferProtocol(
@@ -118,6 +158,7 @@ public class MockServer {
         )
 
         self.port = result
+        pact.hasStartedMockServer = true
         Logging.log(.debug, message: "Mock server started on port \(result)")
     }
 
@@ -133,6 +174,40 @@ public class MockServer {
         ffiProvider.mockServerMismatches(port: port)
     }
 
+    /// Decode the mismatches following interaction testing.
+    ///
+    /// The mismatches are decoded directly from the buffer returned by the Pact FFI without copying it
+    /// into a Swift `String` first.
+    ///
+    /// - Throws: A `DecodingError` if the mismatches can not be decoded.
+    ///
+    /// - Parameters:
+    ///   - limit: The maximum number of failures to decode. Decoding stops once `limit` failures have
+    ///   been decoded. Use `nil` to decode every failure.
+    ///
+    /// - Returns: The verification failures, or an empty array if the mock server reported none.
+    ///
+    public func verificationFailures(limit: Int? = nil) throws -> [PactVerificationFailure] {
+        try withMismatches(ffiProvider.mockServerMismatchesBuffer(port: port)) { bytes in
+            guard let bytes = bytes else {
+                return []
+            }
+            return try MismatchesDecoder.decode(bytes, limit: limit)
+        }
+    }
+
+    /// The failures the mock server recorded, decoded lazily as they are iterated.
+    ///
+    /// The failures are read from the mock server's own mismatches buffer, without copying it. No failure
+    /// is decoded until it is reached.
+    ///
+    public var failures: PactVerificationFailures {
+        guard let buffer = ffiProvider.mockServerMismatchesBuffer(port: port) else {
+            return PactVerificationFailures(json: Data())
+        }
+        return PactVerificationFailures(source: .mockServer(self, buffer))
+    }
+
     /// Get a string representing the mock server logs following interaction testing
     ///
     /// - Note: This needs the memory `buffer` log sink to be setup before the mock server is started.
@@ -145,6 +220,123 @@ public class MockServer {
     }
 }
 
+// MARK: - Async Lifecycle
+
+public extension MockServer {
+
+    /// Starts a MockServer without blocking a Swift concurrency thread.
+    ///
+    /// Starting the mock server blocks on the Pact FFI, so the work is moved onto a dedicated executor.
+    ///
+    /// - Throws: ``MockServer/Error`` on error.
+    /// - Parameters:
+    ///   - pact: The ``Pact`` to create the server with.
+    ///   - transferProtocol: The protocol to use when communicating with the mock server; defaults to `.standard`.
+    ///   - port: The port on which to run mock server; use `nil` for a random port.
+    ///
+    static func start(pact: Pact, transferProtocol: TransferProtocol = .standard, port: Int32? = nil) async throws -> MockServer {
+        try await start(
+            pact: pact,
+            transferProtocol: transferProtocol,
+            port: port,
+            ffiProvider: DefaultPactFFIProvider(),
+            certificateAuthority: .shared
+        )
+    }
+
+    /// Shuts the mock server down without blocking a Swift concurrency thread.
+    ///
+    /// Subsequent calls, and the eventual `deinit`, do nothing.
+    func shutdown() async {
+        await FFIExecutor.run { self.stop() }
+    }
+
+    /// Shuts down `mockServers` concurrently and returns once every one of them has shut down.
+    ///
+    /// - Parameters:
+    ///   - mockServers: The mock servers to shut down.
+    ///
+    static func shutdown(_ mockServers: [MockServer]) async {
+        await withTaskGroup(of: Void.self) { group in
+            for mockServer in mockServers {
+                group.addTask {
+                    await mockServer.shutdown()
+                }
+            }
+        }
+    }
+}
+
+extension MockServer {
+
+    static func start(
+        pact: Pact,
+        transferProtocol: TransferProtocol = .standard,
+        port: Int32? = nil,
+        ffiProvider: PactFFIProviding,
+        certificateAuthority: TLSCertificateAuthority? = nil
+    ) async throws -> MockServer {
+        try await FFIExecutor.run {
+            try MockServer(
+                pact: pact,
+                transferProtocol: transferProtocol,
+                port: port,
+                ffiProvider: ffiProvider,
+                certificateAuthority: certificateAuthority
+            )
+        }
+    }
+}
+
+// MARK: - Quiescence
+
+public extension MockServer {
+
+    /// Waits until the mock server has not recorded any request activity for `quiescence.idleWindow`.
+    ///
+    /// Call this before checking ``requestsMatched`` when the consumer may still be sending, or the
+    /// mock server may still be recording, a request. At `trace` level a large binary body can still be
+    /// logged after the client has received its response. Activity is observed through the length of the
+    /// mock server's own log stream, or the number of its mismatches, once per idle window, so there is no
+    /// need for a fixed sleep.
+    ///
+    /// - Note: The Pact core keeps every copy of the logs or mismatches it hands out until the mock server is
+    /// shut down, so they are only read once per idle window. Log activity is only visible with the
+    /// ``Logging/Sink/buffer`` sink configured; without it only mismatches are observed.
+    ///
+    /// - Parameters:
+    ///   - quiescence: The idle window and timeout to use.
+    ///
+    /// - Returns: `true` if the mock server went quiet within the timeout, otherwise `false`.
+    ///
+    @discardableResult
+    func awaitQuiescence(_ quiescence: Quiescence = Quiescence()) async -> Bool {
+        let deadline = Date().addingTimeInterval(quiescence.timeout)
+        var lastActivity = await FFIExecutor.run { self.activity }
+        var lastChange = Date()
+
+        while true {
+            let now = Date()
+            if now.timeIntervalSince(lastChange) >= quiescence.idleWindow {
+                return true
+            }
+            if now >= deadline {
+                Logging.log(.warn, message: "Mock server on port \(port) did not become quiescent within \(quiescence.timeout)s")
+                return false
+            }
+
+            let pollInterval = min(quiescence.idleWindow, deadline.timeIntervalSince(now))
+            try? await Task.sleep(nanoseconds: UInt64(max(0, pollInterval) * Self.nanosecondsPerSecond))
+
+            let activity = await FFIExecutor.run { self.activity }
+            if activity != lastActivity {
+                lastActivity = activity
+                lastChange = Date()
+            }
+        }
+    }
+}
+
 // MARK: - Error Extensions
 
 extension MockServer.Error: LocalizedError {
@@ -213,14 +405,55 @@ extension MockServer.Error: RawRepresentable {
 // MARK: - Private
 
 private extension MockServer {
-    /// Finds an unsued port on Darwin. Returns `0` on Linux.
-    ///
-    static var randomPort: Int32 {
-        #if os(Linux)
-        return 0
-        #else
-        // Darwin doesn't open a random available port if `0` value is sent to pactffi_create_mock_server(_:_:_:)
-        return SocketBinder.unusedPort()
-        #endif
+
+    static let nanosecondsPerSecond: TimeInterval = 1_000_000_000
+
+    /// A snapshot of the mock server's request activity.
+    struct Activity: Equatable {
+        let logsLength: Int
+        let mismatchCount: Int
+    }
+
+    /// The length of the mock server's logs or, when it has none, the number of its mismatches.
+    ///
+    /// Each read makes the Pact core copy the logs or mismatches, so only one of them is read.
+    var activity: Activity {
+        if let logsLength = ffiProvider.mockServerLogsLength(port: port), logsLength > 0 {
+            return Activity(logsLength: logsLength, mismatchCount: 0)
+        }
+        let mismatchCount = (try? verificationFailures().count) ?? 0
+        return Activity(logsLength: 0, mismatchCount: mismatchCount)
+    }
+
+    /// Calls `body` with `buffer`, a mismatches buffer fetched from this server, or `nil` once the server was shut down.
+    ///
+    /// The server isn't shut down, which would release the buffer, until `body` returns.
+    ///
+    func withMismatches<Result>(
+        _ buffer: UnsafeBufferPointer<UInt8>?,
+        _ body: (UnsafeBufferPointer<UInt8>?) throws -> Result
+    ) rethrows -> Result {
+        lifecycleLock.lock()
+        defer { lifecycleLock.unlock() }
+
+        return try body(isShutDown ? nil : buffer)
+    }
+
+    /// Shuts the mock server down. Only the first call has any effect.
+    func stop() {
+        lifecycleLock.lock()
+        guard isShutDown == false else {
+            lifecycleLock.unlock()
+            return
+        }
+        isShutDown = true
+        lifecycleLock.unlock()
+
+        if port != 0 {
+            Logging.log(.debug, message: "Shutting down mock server on port \(port)...")
+            if ffiProvider.mockServerCleanup(port: port) == false {
+                Logging.log(.debug, message: "Failed to shut down mock server!")
+            }
+        }
     }
 }
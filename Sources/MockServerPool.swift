@@ -0,0 +1,241 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// An opt-in pool of running ``MockServer`` instances keyed by the contract of their ``Pact``.
+///
+/// The Pact mock server records matched requests and mismatches for its whole lifetime and the Pact core
+/// can't reset them, so a server is never handed out twice. Instead, once the same contract has been requested
+/// a second time the pool starts a spare for it in the background after each request. The next identical Pact
+/// takes the spare, which has not served a single request, without waiting for a server to start. A contract
+/// requested only once costs a single server start, as it would without the pool.
+///
+/// Contracts are identified by the calls that configured the Pact and its interactions, recorded in memory,
+/// so looking one up never serialises the Pact. Spares are started from the first Pact the pool saw for the
+/// contract, which the pool keeps until the contract is evicted. They serve exactly the interactions of every
+/// Pact with the same contract.
+///
+/// To use the pool with ``PactBuilder``, pass it in ``PactBuilder/Config``:
+///
+/// ```swift
+/// let config = PactBuilder.Config(pactDirectory: directory, mockServerPool: .shared)
+/// ```
+///
+public final class MockServerPool: @unchecked Sendable {
+
+    /// A pool shared across the test bundle.
+    public static let shared = MockServerPool()
+
+    /// The maximum number of contracts the pool keeps, each with at most one spare mock server.
+    public let capacity: Int
+
+    fileprivate struct Key: Hashable {
+        let transferProtocol: MockServer.TransferProtocol
+        let contract: AnyHashable
+    }
+
+    /// A contract requested from the pool.
+    private struct Entry {
+        /// The Pact spares for the contract are started from.
+        let pact: Pact
+        var spare: MockServer?
+    }
+
+    private let lock = NSLock()
+    private let spareQueue = DispatchQueue(label: "au.com.pact-foundation.PactSwiftMockServer.mock-server-pool", qos: .utility)
+    private let makeServer: (Pact, MockServer.TransferProtocol) throws -> MockServer
+    private var entries: [Key: Entry] = [:]
+    private var recentlyUsed: [Key] = []
+    private var hitCount = 0
+    private var missCount = 0
+
+    /// - Parameters:
+    ///   - capacity: The maximum number of contracts the pool keeps. The least recently requested contract and
+    ///   its spare are dropped when a new one would exceed it. Defaults to `8`.
+    ///
+    public convenience init(capacity: Int = 8) {
+        self.init(capacity: capacity) { pact, transferProtocol in
+            try MockServer(pact: pact, transferProtocol: transferProtocol)
+        }
+    }
+
+    internal init(capacity: Int, makeServer: @escaping (Pact, MockServer.TransferProtocol) throws -> MockServer) {
+        precondition(capacity > 0, "The pool capacity must be greater than zero!")
+        self.capacity = capacity
+        self.makeServer = makeServer
+    }
+
+    // MARK: - Interface
+
+    /// The number of requests served by a spare mock server.
+    public var hits: Int {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return hitCount
+    }
+
+    /// The number of requests that had to start a new mock server.
+    public var misses: Int {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return missCount
+    }
+
+    /// The number of spare mock servers currently kept running by the pool.
+    public var residentCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return entries.values.filter { $0.spare != nil }.count
+    }
+
+    /// Returns a running mock server for the interactions registered on `pact` that has not served any request.
+    ///
+    /// The caller owns the returned server and shuts it down when done with it. `pact` can't be changed any
+    /// more afterwards, whether the server was started for it or is a spare.
+    ///
+    /// - Throws: ``MockServer/Error`` if a new mock server fails to start.
+    ///
+    /// - Parameters:
+    ///   - pact: The ``Pact`` to find or start a mock server for.
+    ///   - transferProtocol: The protocol to use when communicating with the mock server; defaults to `.standard`.
+    ///
+    public func mockServer(for pact: Pact, transferProtocol: MockServer.TransferProtocol = .standard) throws -> MockServer {
+        let key = Key(transferProtocol: transferProtocol, contract: pact.contractFingerprint)
+
+        // Servers are released after the lock is given up as shutting a mock server down blocks on the FFI.
+        var evicted: [MockServer] = []
+
+        lock.lock()
+        let isKnown = entries[key] != nil
+        let spare = entries[key]?.spare
+        if isKnown {
+            entries[key]?.spare = nil
+        } else {
+            entries[key] = Entry(pact: pact, spare: nil)
+        }
+        if spare != nil {
+            hitCount += 1
+        } else {
+            missCount += 1
+        }
+        touch(key)
+        evicted = evictIfNeeded()
+        lock.unlock()
+
+        evicted.removeAll()
+
+        // Starting a mock server blocks on the FFI, so it never happens while holding the lock.
+        let server: MockServer
+        if let spare = spare {
+            Logging.log(.debug, message: "Handing out spare mock server on port \(spare.port)")
+            pact.hasStartedMockServer = true
+            server = spare
+        } else {
+            server = try makeServer(pact, transferProtocol)
+        }
+
+        // The contract has been asked for before, so it is likely to be asked for again.
+        if isKnown {
+            startSpare(for: key)
+        }
+        return server
+    }
+
+    /// Shuts down every spare mock server, forgets every contract and resets the counters.
+    public func drain() {
+        // Spares still starting are inserted before the pool is drained.
+        spareQueue.sync { }
+
+        var drained: [Key: Entry] = [:]
+
+        lock.lock()
+        swap(&drained, &entries)
+        recentlyUsed.removeAll()
+        hitCount = 0
+        missCount = 0
+        lock.unlock()
+
+        Logging.log(.debug, message: "Draining \(drained.values.filter { $0.spare != nil }.count) pooled mock server(s)")
+    }
+
+    // MARK: - Internal
+
+    /// Waits until every spare requested so far has started.
+    internal func waitForSpares() {
+        spareQueue.sync { }
+    }
+}
+
+// MARK: - Private
+
+private extension MockServerPool {
+
+    /// Starts a spare server for `key` from the contract's own Pact in the background unless one is already running.
+    func startSpare(for key: Key) {
+        spareQueue.async { [weak self] in
+            guard let self = self, let pact = self.pactNeedingSpare(for: key) else {
+                return
+            }
+
+            let spare: MockServer
+            do {
+                spare = try self.makeServer(pact, key.transferProtocol)
+            } catch {
+                Logging.log(.warn, message: "Failed to start a spare mock server: \(error.localizedDescription)")
+                return
+            }
+
+            // A spare whose contract was evicted meanwhile is shut down once released, after the lock is given up.
+            var released = [spare]
+
+            self.lock.lock()
+            if self.entries[key] != nil, self.entries[key]?.spare == nil {
+                self.entries[key]?.spare = spare
+                released.removeAll()
+            }
+            self.lock.unlock()
+
+            released.removeAll()
+        }
+    }
+
+    /// The Pact to start a spare for `key` from, or `nil` if the contract is gone or already has a spare.
+    func pactNeedingSpare(for key: Key) -> Pact? {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard let entry = entries[key], entry.spare == nil else {
+            return nil
+        }
+        return entry.pact
+    }
+
+    /// Marks `key` as the most recently used. Must be called while holding `lock`.
+    func touch(_ key: Key) {
+        if let index = recentlyUsed.firstIndex(of: key) {
+            recentlyUsed.remove(at: index)
+        }
+        recentlyUsed.append(key)
+    }
+
+    /// Removes the least recently used contracts above `capacity` and returns their spares. Must be called while holding `lock`.
+    func evictIfNeeded() -> [MockServer] {
+        var evicted: [MockServer] = []
+        while recentlyUsed.count > capacity {
+            let key = recentlyUsed.removeFirst()
+            if let server = entries.removeValue(forKey: key)?.spare {
+                Logging.log(.debug, message: "Evicting spare mock server on port \(server.port)")
+                evicted.append(server)
+            }
+        }
+        return evicted
+    }
+}
@@ -0,0 +1,310 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// Writes log records to a file in batches on a background queue, rotating the file by size.
+///
+/// With ``Logging/Sink/file(_:)`` the Pact core writes every record to disk on the thread logging it. A
+/// `FileLogSink` takes records straight from ``Logging/log(_:message:)``, or from the in-memory log buffer,
+/// and writes everything collected every ``flushInterval`` seconds in one write.
+///
+/// With the default ``Source/messages(filter:)`` source logging never waits on disk: records arriving while
+/// ``capacity`` records are already waiting are dropped and counted. The ``Source/buffer`` source is not
+/// bounded by ``capacity``, and every write fetches the whole log buffer from the Pact core, so its cost grows
+/// with everything logged so far.
+///
+/// ```swift
+/// let sink = FileLogSink(path: "/tmp/pact.log")
+/// sink.start()
+/// // ...
+/// sink.stop()
+/// ```
+///
+public final class FileLogSink: @unchecked Sendable {
+
+    /// Where a sink takes its records from.
+    public enum Source: Sendable {
+
+        /// The Pact core's in-memory log buffer. Requires the ``Logging/Sink/buffer`` sink to be configured.
+        ///
+        /// - Note: Every write fetches the whole buffer, which the Pact core never trims, and writes the lines
+        /// logged since the previous write. ``FileLogSink/capacity`` doesn't apply.
+        case buffer
+
+        /// The messages logged with ``Logging/log(_:message:)`` at or above `filter`, without going through the Pact core.
+        case messages(filter: Logging.Filter)
+    }
+
+    /// The work the sink has done so far.
+    public struct Statistics: Sendable, Equatable {
+
+        /// The number of records written.
+        public let records: Int
+
+        /// The number of bytes written, across every rotated file.
+        public let bytes: Int
+
+        /// The number of times the file was rotated.
+        public let rotations: Int
+
+        /// The number of records dropped because too many were waiting to be written.
+        public let dropped: Int
+    }
+
+    /// The path of the file written to.
+    public let path: String
+
+    /// Where the records are taken from.
+    public let source: Source
+
+    /// The file size, in bytes, above which the file is rotated.
+    public let maxFileSize: Int
+
+    /// The number of rotated files kept, named `path.1` (the most recent) to `path.<maxRotatedFiles>`.
+    public let maxRotatedFiles: Int
+
+    /// How often the collected records are written, in seconds.
+    public let flushInterval: TimeInterval
+
+    /// The number of records waiting to be written above which new records are dropped.
+    ///
+    /// Only applies to the ``Source/messages(filter:)`` source.
+    ///
+    public var capacity: Int {
+        pending.capacity
+    }
+
+    private let pending: RingBuffer<Record>
+    private let queue = DispatchQueue(label: "au.com.pact-foundation.PactSwiftMockServer.file-log-sink", qos: .utility)
+
+    // State only accessed on `queue`.
+    private var fileHandle: FileHandle?
+    private var fileSize = 0
+    private var cursor: LogCursor?
+
+    private let lock = NSLock()
+    private var timer: DispatchSourceTimer?
+    private var recordCount = 0
+    private var byteCount = 0
+    private var rotationCount = 0
+
+    /// - Parameters:
+    ///   - path: The path of the file to write to. Records are appended to an existing file.
+    ///   - source: Where to take the records from. Defaults to the messages logged at ``Logging/Filter/info``
+    ///   or above.
+    ///   - maxFileSize: The file size, in bytes, above which the file is rotated. Defaults to 10 MiB.
+    ///   - maxRotatedFiles: The number of rotated files kept. Defaults to `3`.
+    ///   - flushInterval: How often the collected records are written, in seconds. Defaults to `0.25`.
+    ///   - capacity: The number of records waiting to be written above which new records are dropped. Only applies
+    ///   to the ``Source/messages(filter:)`` source. Defaults to `8_192`.
+    ///
+    public init(
+        path: String,
+        source: Source = .messages(filter: .info),
+        maxFileSize: Int = 10 * 1_024 * 1_024,
+        maxRotatedFiles: Int = 3,
+        flushInterval: TimeInterval = 0.25,
+        capacity: Int = 8_192
+    ) {
+        self.path = path
+        self.source = source
+        self.maxFileSize = max(1, maxFileSize)
+        self.maxRotatedFiles = max(0, maxRotatedFiles)
+        self.flushInterval = flushInterval
+        self.pending = RingBuffer(capacity: capacity)
+    }
+
+    deinit {
+        timer?.cancel()
+        fileHandle?.closeFile()
+    }
+
+    // MARK: - Interface
+
+    /// The work the sink has done so far.
+    public var statistics: Statistics {
+        let dropped = pending.dropped
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        return Statistics(records: recordCount, bytes: byteCount, rotations: rotationCount, dropped: dropped)
+    }
+
+    /// Starts collecting records and writing them every ``flushInterval`` seconds.
+    ///
+    /// With the ``Source/buffer`` source only records logged after the sink starts are written.
+    ///
+    public func start() {
+        lock.lock()
+        guard timer == nil else {
+            lock.unlock()
+            return
+        }
+        let timer = DispatchSource.makeTimerSource(queue: queue)
+        self.timer = timer
+        lock.unlock()
+
+        switch source {
+        case .buffer:
+            queue.sync { cursor = LogCursor() }
+        case .messages:
+            Logging.addMessageSink(self)
+        }
+
+        timer.schedule(deadline: .now() + flushInterval, repeating: flushInterval)
+        timer.setEventHandler { [weak self] in
+            self?.writePending()
+        }
+        timer.resume()
+    }
+
+    /// Writes every record collected so far and waits for the write to finish.
+    public func flush() {
+        queue.sync { writePending() }
+    }
+
+    /// Stops collecting records, writes the records already collected and closes the file.
+    public func stop() {
+        lock.lock()
+        let timer = self.timer
+        self.timer = nil
+        lock.unlock()
+
+        guard let timer = timer else {
+            return
+        }
+        if case .messages = source {
+            Logging.removeMessageSink(self)
+        }
+        timer.cancel()
+
+        queue.sync {
+            writePending()
+            fileHandle?.closeFile()
+            fileHandle = nil
+            cursor = nil
+        }
+    }
+
+    // MARK: - Internal
+
+    /// The filter of the messages the sink takes from ``Logging/log(_:message:)``, if any.
+    internal var messageFilter: Logging.Filter? {
+        guard case let .messages(filter) = source else {
+            return nil
+        }
+        return filter
+    }
+
+    /// Queues a message logged with ``Logging/log(_:message:)``. Never waits on the file.
+    internal func record(_ level: Logging.Level, message: String) {
+        pending.push(Record(date: Date(), level: level, message: message))
+    }
+}
+
+// MARK: - Private
+
+private extension FileLogSink {
+
+    struct Record {
+        let date: Date
+        let level: Logging.Level
+        let message: String
+    }
+
+    static let timestampFormatter: ISO8601DateFormatter = {
+        let formatter = ISO8601DateFormatter()
+        formatter.formatOptions = [.withInternetDateTime, .withFractionalSeconds]
+        return formatter
+    }()
+
+    /// Writes the records collected since the previous write. Must be called on `queue`.
+    func writePending() {
+        let lines: [String]
+        switch source {
+        case .buffer:
+            lines = cursor?.read() ?? []
+        case .messages:
+            lines = pending.drain().map { record in
+                "\(Self.timestampFormatter.string(from: record.date)) \(record.level.rawValue) pact_swift: \(record.message)"
+            }
+        }
+        guard lines.isEmpty == false else {
+            return
+        }
+
+        var batch = Data()
+        for line in lines {
+            batch.append(contentsOf: line.utf8)
+            batch.append(UInt8(ascii: "\n"))
+        }
+
+        do {
+            try rotateIfNeeded(adding: batch.count)
+            try openedFileHandle().write(batch)
+            fileSize += batch.count
+
+            lock.lock()
+            recordCount += lines.count
+            byteCount += batch.count
+            lock.unlock()
+        } catch {
+            // Logging the failure would feed it straight back into this sink.
+            fputs("Failed to write log file '\(path)': \(error.localizedDescription)\n", stderr)
+        }
+    }
+
+    /// The handle of the log file, opening it for appending if needed. Must be called on `queue`.
+    func openedFileHandle() throws -> FileHandle {
+        if let fileHandle = fileHandle {
+            return fileHandle
+        }
+
+        let fileManager = FileManager.default
+        if fileManager.fileExists(atPath: path) == false {
+            try fileManager.createDirectory(
+                at: URL(fileURLWithPath: path).deletingLastPathComponent(),
+                withIntermediateDirectories: true
+            )
+            fileManager.createFile(atPath: path, contents: nil)
+        }
+
+        let fileHandle = try FileHandle(forWritingTo: URL(fileURLWithPath: path))
+        fileSize = Int(fileHandle.seekToEndOfFile())
+        self.fileHandle = fileHandle
+        return fileHandle
+    }
+
+    /// Rotates the file when writing `count` more bytes would take it above `maxFileSize`. Must be called on `queue`.
+    func rotateIfNeeded(adding count: Int) throws {
+        _ = try openedFileHandle()
+        guard fileSize > 0, fileSize + count > maxFileSize else {
+            return
+        }
+
+        fileHandle?.closeFile()
+        fileHandle = nil
+        fileSize = 0
+
+        let fileManager = FileManager.default
+        if maxRotatedFiles == 0 {
+            try fileManager.removeItem(atPath: path)
+        } else {
+            try? fileManager.removeItem(atPath: "\(path).\(maxRotatedFiles)")
+            for index in stride(from: maxRotatedFiles - 1, through: 1, by: -1) where fileManager.fileExists(atPath: "\(path).\(index)") {
+                try fileManager.moveItem(atPath: "\(path).\(index)", toPath: "\(path).\(index + 1)")
+            }
+            try fileManager.moveItem(atPath: path, toPath: "\(path).1")
+        }
+
+        lock.lock()
+        rotationCount += 1
+        lock.unlock()
+    }
+}
@@ -17,12 +17,15 @@ public extension Interaction {
 
         private let ffiProvider: PactFFIProviding
         private let handle: InteractionHandle
+        private let fingerprint: Fingerprint
 
         init(
             handle: InteractionHandle,
+            fingerprint: Fingerprint = Fingerprint(),
             ffiProvider: PactFFIProviding = DefaultPactFFIProvider()
         ) {
             self.handle = handle
+            self.fingerprint = fingerprint
             self.ffiProvider = ffiProvider
         }
 
@@ -44,6 +47,7 @@ public extension Interaction {
         @discardableResult
         public func queryParam(name: String, values: [String]) throws -> Self {
             try ffiProvider.withQueryParameter(handle: handle, name: name, values: values)
+            fingerprint.record("withQueryParameter", name, values)
 
             return self
         }
@@ -60,6 +64,7 @@ public extension Interaction {
         @discardableResult
         public func header(_ name: String, value: String) throws -> Self {
             try ffiProvider.withHeader(handle: handle, name: name, value: value, interactionPart: .request)
+            fingerprint.record("withHeader.request", name, value)
 
             return self
         }
@@ -76,6 +81,7 @@ public extension Interaction {
         @discardableResult
         public func header(_ name: String, values: [String]) throws -> Self {
             try ffiProvider.withHeader(handle: handle, name: name, values: values, interactionPart: .request)
+            fingerprint.record("withHeader.request", name, values)
 
             return self
         }
@@ -96,6 +102,7 @@ public extension Interaction {
         @discardableResult
         public func body(_ body: String? = nil, contentType: String = "text/plain") throws -> Self {
             try ffiProvider.withBody(handle: handle, body: body, contentType: contentType, interactionPart: .request)
+            fingerprint.record("withBody.request", body, contentType)
 
             return self
         }
@@ -116,6 +123,76 @@ public extension Interaction {
         @discardableResult
         public func body(_ body: Data, contentType: String = "application/octet-stream") throws -> Self {
             try ffiProvider.withBody(handle: handle, body: body, contentType: contentType, interactionPart: .request)
+            fingerprint.record("withBody.request", body, contentType)
+
+            return self
+        }
+
+        /// Adds a JSON body with embedded matching rules for the ``Interaction``.
+        ///
+        /// The body was serialised when the ``MatchingBody`` was created and is passed to the Pact FFI without copying.
+        ///
+        /// - Parameters:
+        ///   - body: The serialised body.
+        ///   - contentType: The content type of the body. Defaults to `application/json`.
+        ///
+        /// - Throws: ``Interaction/Error/canNotBeModified`` if the interaction or Pact can't be modified
+        /// (i.e. the mock server for it has already started) or an error has occurred.
+        ///
+        @discardableResult
+        public func body(_ body: MatchingBody, contentType: String = "application/json") throws -> Self {
+            try ffiProvider.withBody(handle: handle, body: body, contentType: contentType, interactionPart: .request)
+            fingerprint.record("withBody.request", body.buffer.bytes, contentType)
+
+            return self
+        }
+
+        /// Adds the contents of the file at `fileURL` as the binary body for the ``Interaction``.
+        ///
+        /// The file is memory-mapped rather than read onto the heap, so large fixtures don't add to peak memory.
+        /// The example body is written to the Pact, and the body is matched on its content type only.
+        ///
+        /// - Parameters:
+        ///   - fileURL: The URL of the file with the example body content.
+        ///   - contentType: The content type of the body.
+        ///
+        /// - Throws: An error if the file can't be read, or ``Interaction/Error/canNotBeModified`` if the interaction
+        /// or Pact can't be modified (i.e. the mock server for it has already started) or an error has occurred.
+        ///
+        @discardableResult
+        public func body(fileURL: URL, contentType: String) throws -> Self {
+            let body = try Data(contentsOf: fileURL, options: .alwaysMapped)
+            try ffiProvider.withBinaryFile(handle: handle, body: body, contentType: contentType, interactionPart: .request)
+            fingerprint.record("withBinaryFile.request", body, contentType)
+
+            return self
+        }
+
+        /// Adds a file from disk as a part of a `multipart/form-data` request body.
+        ///
+        /// The Pact core reads the file itself, so the encoded body is never built in Swift. Call this once for
+        /// every part; each call appends a new part. The part is matched on its content type.
+        ///
+        /// - Parameters:
+        ///   - part: The name of the part.
+        ///   - file: The URL of the file with the example part content.
+        ///   - contentType: The content type of the part.
+        ///   - boundary: The boundary separating the parts. If `nil`, a random boundary is used.
+        ///
+        /// - Throws: ``Interaction/Error/multipartFileFailed(_:)`` if the file can't be read, or the interaction or
+        /// Pact can't be modified (i.e. the mock server for it has already started).
+        ///
+        @discardableResult
+        public func multipart(part: String, file: URL, contentType: String, boundary: String? = nil) throws -> Self {
+            try ffiProvider.withMultipartFile(
+                handle: handle,
+                path: file.path,
+                partName: part,
+                contentType: contentType,
+                boundary: boundary,
+                interactionPart: .request
+            )
+            fingerprint.record("withMultipartFile", part, file.path, contentType, boundary)
 
             return self
         }
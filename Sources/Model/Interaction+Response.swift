@@ -16,10 +16,12 @@ public extension Interaction {
     struct Response: HeaderBuilder, BodyBuilder {
 
         private let handle: InteractionHandle
+        private let fingerprint: Fingerprint
         private let ffiProvider: PactFFIProviding
 
-        init(handle: InteractionHandle, ffiProvider: PactFFIProviding = DefaultPactFFIProvider()) {
+        init(handle: InteractionHandle, fingerprint: Fingerprint = Fingerprint(), ffiProvider: PactFFIProviding = DefaultPactFFIProvider()) {
             self.handle = handle
+            self.fingerprint = fingerprint
             self.ffiProvider = ffiProvider
         }
 
@@ -33,6 +35,7 @@ public extension Interaction {
         @discardableResult
         public func status(_ status: Int) throws -> Self {
             try ffiProvider.withStatus(handle: handle, status: status)
+            fingerprint.record("withStatus", status)
 
             return self
         }
@@ -48,6 +51,7 @@ public extension Interaction {
         @discardableResult
         public func header(_ name: String, value: String) throws -> Self {
             try ffiProvider.withHeader(handle: handle, name: name, value: value, interactionPart: .response)
+            fingerprint.record("withHeader.response", name, value)
 
             return self
         }
@@ -63,6 +67,7 @@ public extension Interaction {
         @discardableResult
         public func header(_ name: String, values: [String]) throws -> Self {
             try ffiProvider.withHeader(handle: handle, name: name, values: values, interactionPart: .response)
+            fingerprint.record("withHeader.response", name, values)
 
             return self
         }
@@ -82,6 +87,7 @@ public extension Interaction {
         @discardableResult
         public func body(_ body: String? = nil, contentType: String = "text/plain") throws -> Self {
             try ffiProvider.withBody(handle: handle, body: body, contentType: contentType, interactionPart: .response)
+            fingerprint.record("withBody.response", body, contentType)
 
             return self
         }
@@ -102,6 +108,47 @@ public extension Interaction {
         @discardableResult
         public func body(_ body: Data, contentType: String = "application/octet-stream") throws -> Self {
             try ffiProvider.withBody(handle: handle, body: body, contentType: contentType, interactionPart: .response)
+            fingerprint.record("withBody.response", body, contentType)
+
+            return self
+        }
+
+        /// Adds a JSON body with embedded matching rules for the ``Interaction``.
+        ///
+        /// The body was serialised when the ``MatchingBody`` was created and is passed to the Pact FFI without copying.
+        ///
+        /// - Parameters:
+        ///   - body: The serialised body.
+        ///   - contentType: The content type of the body. Defaults to `application/json`.
+        ///
+        /// - Throws: ``Interaction/Error/canNotBeModified`` if the interaction or Pact can't be modified
+        /// (i.e. the mock server for it has already started) or an error has occurred.
+        ///
+        @discardableResult
+        public func body(_ body: MatchingBody, contentType: String = "application/json") throws -> Self {
+            try ffiProvider.withBody(handle: handle, body: body, contentType: contentType, interactionPart: .response)
+            fingerprint.record("withBody.response", body.buffer.bytes, contentType)
+
+            return self
+        }
+
+        /// Adds the contents of the file at `fileURL` as the binary body for the ``Interaction``.
+        ///
+        /// The file is memory-mapped rather than read onto the heap, so large fixtures don't add to peak memory.
+        /// The example body is written to the Pact, and the body is matched on its content type only.
+        ///
+        /// - Parameters:
+        ///   - fileURL: The URL of the file with the example body content.
+        ///   - contentType: The content type of the body.
+        ///
+        /// - Throws: An error if the file can't be read, or ``Interaction/Error/canNotBeModified`` if the interaction
+        /// or Pact can't be modified (i.e. the mock server for it has already started) or an error has occurred.
+        ///
+        @discardableResult
+        public func body(fileURL: URL, contentType: String) throws -> Self {
+            let body = try Data(contentsOf: fileURL, options: .alwaysMapped)
+            try ffiProvider.withBinaryFile(handle: handle, body: body, contentType: contentType, interactionPart: .response)
+            fingerprint.record("withBinaryFile.response", body, contentType)
 
             return self
         }
@@ -19,6 +19,7 @@ public final class Interaction {
         case canNotBeModified
         case unsupportedForSpecificationVersion
         case unknownResult(Int)
+        case multipartFileFailed(String?)
     }
 
     public typealias RequestBuilder = (Request) throws -> Void
@@ -27,16 +28,23 @@ public final class Interaction {
     // MARK: - Interaction
 
     /// HTTP Method for an ``Interaction``.
-    public enum HTTPMethod: String {
+    public enum HTTPMethod: String, Sendable {
         case GET, HEAD, POST, PUT, PATCH, DELETE, TRACE, CONNECT, OPTIONS
     }
 
     private let handle: InteractionHandle
     private let ffiProvider: PactFFIProviding
 
+    /// The expected request method and path.
+    internal private(set) var expectedRequest: (method: HTTPMethod, path: String)?
+
+    /// The calls that configured this interaction.
+    internal let fingerprint = Fingerprint()
+
     internal init(pactHandle: PactHandle, description: String, ffiProvider: PactFFIProviding = DefaultPactFFIProvider()) {
         self.ffiProvider = ffiProvider
         self.handle = ffiProvider.newInteraction(handle: pactHandle, description: description)
+        fingerprint.record("newInteraction", description)
     }
 
     /// Adds a provider state to the Interaction.
@@ -51,6 +59,7 @@ public final class Interaction {
     @discardableResult
     internal func given(_ description: String) throws -> Self {
         try ffiProvider.given(handle: handle, description: description)
+        fingerprint.record("given", description)
 
         return self
     }
@@ -70,6 +79,7 @@ public final class Interaction {
     public func testName(_ name: String) throws -> Self {
         precondition(name.isEmpty == false, "The test name must not be empty!")
         try ffiProvider.interactionTestName(handle: handle, name: name)
+        fingerprint.record("interactionTestName", name)
 
         return self
     }
@@ -86,6 +96,7 @@ public final class Interaction {
     @discardableResult
     internal func given(_ description: String, withName name: String, value: String) throws -> Self {
         try ffiProvider.given(handle: handle, description: description, name: name, value: value)
+        fingerprint.record("given", description, name, value)
 
         return self
     }
@@ -102,8 +113,10 @@ public final class Interaction {
     @discardableResult
     public func withRequest(method: HTTPMethod = .GET, path: String = "/", builder: RequestBuilder = { _ in }) throws -> Self {
         try ffiProvider.withRequest(handle: handle, method: method, path: path)
+        fingerprint.record("withRequest", method, path)
+        expectedRequest = (method, path)
 
-        let request = Request(handle: handle)
+        let request = Request(handle: handle, fingerprint: fingerprint)
         try builder(request)
 
         return self
@@ -111,19 +124,44 @@ public final class Interaction {
 
     @discardableResult
     public func willRespond(with status: Int, builder: ResponseBuilder = { _ in }) throws -> Self {
-        let response = Response(handle: handle)
+        let response = Response(handle: handle, fingerprint: fingerprint)
         try response.status(status)
         try builder(response)
 
         return self
     }
+
+    /// Configures the request and the response of the ``Interaction`` from `spec` in one pass.
+    ///
+    /// - Parameters:
+    ///   - spec: The request and response to configure.
+    ///
+    /// - Throws: ``Interaction/Error/canNotBeModified`` if the interaction or Pact can't be modified (i.e. the mock server for it has already started)
+    ///
+    @discardableResult
+    public func apply(_ spec: InteractionSpec) throws -> Self {
+        try apply(CompiledInteractionSpec(spec))
+    }
+
+    /// Configures the request and the response of the ``Interaction`` from an already compiled `spec`.
+    ///
+    /// - Throws: ``Interaction/Error/canNotBeModified`` if the interaction or Pact can't be modified (i.e. the mock server for it has already started)
+    ///
+    @discardableResult
+    internal func apply(_ spec: CompiledInteractionSpec) throws -> Self {
+        try ffiProvider.apply(spec, handle: handle)
+        fingerprint.record("apply", spec.source)
+        expectedRequest = spec.expectedRequest
+
+        return self
+    }
 }
 
 // MARK: - Extension
 
 public extension Interaction {
 
-    struct ProviderState: Hashable {
+    struct ProviderState: Hashable, Sendable {
         var description: String
         var name: String?
         var value: String?
@@ -201,6 +239,11 @@ extension Interaction.Error: LocalizedError {
                 NSLocalizedString("Unknown result (error code: %d)", comment: "Error message when an unknown result is returned"),
                 code
             )
+        case .multipartFileFailed(let errorMessage):
+            return String.localizedStringWithFormat(
+                NSLocalizedString("Can not add multipart file (error: %@)", comment: "Error message when a multipart file can not be added"),
+                errorMessage ?? ""
+            )
         case .panic(let errorMessage):
             return String.localizedStringWithFormat(
                 NSLocalizedString("Function panicked (error: %@)", comment: "Error message when a rust function panics"),
@@ -0,0 +1,96 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// The request and response of an HTTP ``Interaction``, collected in Swift and applied in one pass.
+///
+/// ``Interaction/withRequest(method:path:builder:)`` and ``Interaction/willRespond(with:builder:)`` cross into
+/// the Pact FFI for every header value, query value and body as they are configured. An `InteractionSpec`
+/// is applied with ``Interaction/apply(_:)`` instead, which sets all the values of a header or query
+/// parameter with a single call and bridges every string through one shared buffer.
+///
+/// ```swift
+/// var spec = InteractionSpec(path: "/events", status: 200)
+/// spec.request.query = [.init("page", values: ["1"])]
+/// spec.response.headers = [.init("Content-Type", values: ["application/json"])]
+/// spec.response.body = .text("[]", contentType: "application/json")
+///
+/// try builder.uponReceiving("a request for events").apply(spec)
+/// ```
+///
+public struct InteractionSpec: Sendable, Hashable {
+
+    /// A header or query parameter and its values.
+    public struct Field: Sendable, Hashable {
+        public var name: String
+        public var values: [String]
+
+        /// - Parameters:
+        ///   - name: The name of the header or query parameter.
+        ///   - values: The values. An empty array removes a header, or configures a query parameter without a value.
+        public init(_ name: String, values: [String]) {
+            self.name = name
+            self.values = values
+        }
+    }
+
+    /// The body of a request or response.
+    public enum Body: Sendable, Hashable {
+
+        /// A text body. For JSON payloads, matching rules can be embedded in the body. See
+        /// [IntegrationJson.md](https://github.com/pact-foundation/pact-reference/blob/master/rust/pact_ffi/IntegrationJson.md).
+        case text(String?, contentType: String)
+
+        /// A binary body.
+        case binary(Data, contentType: String)
+    }
+
+    public struct Request: Sendable, Hashable {
+        public var method: Interaction.HTTPMethod
+        public var path: String
+        public var query: [Field]
+        public var headers: [Field]
+        public var body: Body?
+
+        public init(method: Interaction.HTTPMethod = .GET, path: String = "/", query: [Field] = [], headers: [Field] = [], body: Body? = nil) {
+            self.method = method
+            self.path = path
+            self.query = query
+            self.headers = headers
+            self.body = body
+        }
+    }
+
+    public struct Response: Sendable, Hashable {
+        public var status: Int
+        public var headers: [Field]
+        public var body: Body?
+
+        public init(status: Int, headers: [Field] = [], body: Body? = nil) {
+            self.status = status
+            self.headers = headers
+            self.body = body
+        }
+    }
+
+    public var request: Request
+    public var response: Response
+
+    public init(request: Request, response: Response) {
+        self.request = request
+        self.response = response
+    }
+
+    /// - Parameters:
+    ///   - method: The request method. Defaults to ``Interaction/HTTPMethod/GET``.
+    ///   - path: The request path. Defaults to `"/"`.
+    ///   - status: The response status.
+    public init(method: Interaction.HTTPMethod = .GET, path: String = "/", status: Int) {
+        self.init(request: Request(method: method, path: path), response: Response(status: status))
+    }
+}
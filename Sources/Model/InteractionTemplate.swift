@@ -0,0 +1,175 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// An HTTP ``Interaction`` compiled once and stamped into any number of ``Pact`` contracts.
+///
+/// The spec's strings are serialised when the template is created, so stamping it only creates the
+/// interaction and makes the FFI calls that configure it.
+///
+/// Strings may contain `{{name}}` placeholders that are replaced with the `parameters` passed when
+/// stamping. A parameterised template is compiled again for each stamp that passes parameters.
+///
+/// ```swift
+/// let template = InteractionTemplate(
+///     "a request for user {{id}}",
+///     providerStates: ["user {{id}} exists"],
+///     spec: InteractionSpec(path: "/users/{{id}}", status: 200)
+/// )
+///
+/// try builder.uponReceiving(template, parameters: ["id": "1"])
+/// try builder.uponReceiving(template, parameters: ["id": "2"])
+/// ```
+///
+public struct InteractionTemplate: Sendable {
+
+    /// The interaction description.
+    public let description: String
+
+    /// The provider states of the interaction.
+    public let providerStates: [Interaction.ProviderState]
+
+    /// The request and response of the interaction.
+    public let spec: InteractionSpec
+
+    private let compiled: CompiledInteractionSpec
+    private let isParameterised: Bool
+
+    /// - Parameters:
+    ///   - description: The interaction description. It needs to be unique in each Pact the template is stamped into.
+    ///   - providerStates: The provider states of the interaction.
+    ///   - spec: The request and response of the interaction.
+    public init(_ description: String, providerStates: [Interaction.ProviderState] = [], spec: InteractionSpec) {
+        self.description = description
+        self.providerStates = providerStates
+        self.spec = spec
+        self.compiled = CompiledInteractionSpec(spec)
+        self.isParameterised = spec.strings.contains { $0.contains(Self.placeholderPrefix) }
+    }
+
+    // MARK: - Internal
+
+    /// Creates a new ``Interaction`` on `pact` configured from the template.
+    ///
+    /// - Throws: ``Interaction/Error`` if the interaction or Pact can't be modified (i.e. the mock server for it has already started)
+    ///
+    /// - Parameters:
+    ///   - pact: The Pact to add the interaction to.
+    ///   - parameters: The values to replace `{{name}}` placeholders with.
+    ///
+    /// - Returns: The stamped interaction.
+    ///
+    @discardableResult
+    internal func stamp(into pact: Pact, parameters: [String: String] = [:]) throws -> Interaction {
+        try pact.uponReceiving(description.substituting(parameters))
+            .given(providerStates.map { $0.substituting(parameters) })
+            .apply(compiledSpec(parameters: parameters))
+    }
+}
+
+// MARK: - Private
+
+private extension InteractionTemplate {
+
+    static let placeholderPrefix = "{{"
+    static let placeholderSuffix = "}}"
+
+    func compiledSpec(parameters: [String: String]) -> CompiledInteractionSpec {
+        guard isParameterised, parameters.isEmpty == false else {
+            return compiled
+        }
+        return CompiledInteractionSpec(spec.substituting(parameters))
+    }
+}
+
+private extension InteractionSpec {
+
+    /// Every string a placeholder can appear in.
+    var strings: [String] {
+        let fields = request.query + request.headers + response.headers
+        return [request.path]
+            + fields.flatMap { [$0.name] + $0.values }
+            + [request.body, response.body].compactMap { $0?.text }
+    }
+
+    func substituting(_ parameters: [String: String]) -> InteractionSpec {
+        var spec = self
+        spec.request.path = request.path.substituting(parameters)
+        spec.request.query = request.query.map { $0.substituting(parameters) }
+        spec.request.headers = request.headers.map { $0.substituting(parameters) }
+        spec.request.body = request.body?.substituting(parameters)
+        spec.response.headers = response.headers.map { $0.substituting(parameters) }
+        spec.response.body = response.body?.substituting(parameters)
+        return spec
+    }
+}
+
+private extension InteractionSpec.Field {
+
+    func substituting(_ parameters: [String: String]) -> InteractionSpec.Field {
+        InteractionSpec.Field(name.substituting(parameters), values: values.map { $0.substituting(parameters) })
+    }
+}
+
+private extension InteractionSpec.Body {
+
+    var text: String? {
+        if case let .text(text, _) = self {
+            return text
+        }
+        return nil
+    }
+
+    func substituting(_ parameters: [String: String]) -> InteractionSpec.Body {
+        switch self {
+        case let .text(text, contentType):
+            return .text(text?.substituting(parameters), contentType: contentType)
+        case .binary:
+            return self
+        }
+    }
+}
+
+private extension Interaction.ProviderState {
+
+    func substituting(_ parameters: [String: String]) -> Interaction.ProviderState {
+        var state = self
+        state.description = description.substituting(parameters)
+        state.value = value?.substituting(parameters)
+        return state
+    }
+}
+
+private extension String {
+
+    /// The string with every `{{name}}` placeholder replaced with its value in `parameters`.
+    ///
+    /// The string is scanned once, left to right. Placeholders without a value are kept as they are, and the
+    /// substituted values are not scanned for placeholders themselves, so the result never depends on the order
+    /// of `parameters`.
+    func substituting(_ parameters: [String: String]) -> String {
+        guard parameters.isEmpty == false, contains(InteractionTemplate.placeholderPrefix) else {
+            return self
+        }
+
+        var result = ""
+        var remainder = self[...]
+        while let open = remainder.range(of: InteractionTemplate.placeholderPrefix),
+              let close = remainder[open.upperBound...].range(of: InteractionTemplate.placeholderSuffix) {
+            result += remainder[..<open.lowerBound]
+            if let value = parameters[String(remainder[open.upperBound..<close.lowerBound])] {
+                result += value
+            } else {
+                result += remainder[open.lowerBound..<close.upperBound]
+            }
+            remainder = remainder[close.upperBound...]
+        }
+        result += remainder
+        return result
+    }
+}
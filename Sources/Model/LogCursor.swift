@@ -0,0 +1,136 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// Reads the lines added to the in-memory log buffer since the previous read.
+///
+/// ``Logging/buffer`` decodes the whole buffer on every read. A cursor remembers how far it has read and only
+/// decodes the lines logged since. The ``Logging/Sink/buffer`` sink must be configured for the buffer to have
+/// any contents.
+///
+/// - Note: The Pact core has no way to fetch part of its buffer, so every read still fetches, and copies, the
+/// whole buffer. Only splitting and decoding the lines is limited to the new ones.
+///
+/// ```swift
+/// let cursor = LogCursor()
+/// // ... run the code under test ...
+/// XCTAssertTrue(cursor.read().contains { $0.contains("Mock server started") })
+/// ```
+///
+public final class LogCursor: @unchecked Sendable {
+
+    /// The maximum number of bytes of lines kept in ``retained``.
+    public let retainedLimit: Int
+
+    private let lock = NSLock()
+    private var offset: Int
+    private var retainedLines: [String] = []
+    private var retainedCount = 0
+
+    /// - Parameters:
+    ///   - retainedLimit: The maximum number of bytes of lines kept in ``retained``. The oldest lines are
+    ///   dropped first. Defaults to `0`, which keeps no line.
+    ///   - fromStart: When `true` the first read returns the lines already in the buffer, otherwise only
+    ///   lines logged after the cursor was created. Defaults to `false`.
+    ///
+    public init(retainedLimit: Int = 0, fromStart: Bool = false) {
+        self.retainedLimit = max(0, retainedLimit)
+        self.offset = fromStart ? 0 : Self.withBuffer { $0.count }
+    }
+
+    // MARK: - Interface
+
+    /// The lines logged since the previous read.
+    ///
+    /// A line still being written, without its terminating newline, is returned by a later read.
+    ///
+    public func read() -> [String] {
+        lock.lock()
+        defer { lock.unlock() }
+
+        let (lines, consumed) = Self.withBuffer { buffer -> ([String], Int) in
+            // The buffer only grows; a shorter buffer means it was replaced, so it is read from the start.
+            let start = buffer.count < offset ? 0 : offset
+            let unread = UnsafeBufferPointer(rebasing: buffer[start...])
+            guard let lastNewline = unread.lastIndex(of: Self.newline) else {
+                return ([], start)
+            }
+
+            let complete = UnsafeBufferPointer(rebasing: unread[...lastNewline])
+            let lines = complete
+                .split(separator: Self.newline)
+                .map { String(decoding: UnsafeBufferPointer(rebasing: $0), as: UTF8.self) }
+            return (lines, start + complete.count)
+        }
+
+        offset = consumed
+        retain(lines)
+        return lines
+    }
+
+    /// The lines read so far, up to ``retainedLimit`` bytes, joined by newlines.
+    public var retained: String {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return retainedLines.joined(separator: "\n")
+    }
+
+    /// Drops the retained lines and skips over everything logged so far.
+    public func reset() {
+        let end = Self.withBuffer { $0.count }
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        offset = end
+        retainedLines.removeAll()
+        retainedCount = 0
+    }
+}
+
+// MARK: - Private
+
+private extension LogCursor {
+
+    static let newline = UInt8(ascii: "\n")
+
+    /// Calls `body` with the bytes of the log buffer, without copying them into a Swift string.
+    static func withBuffer<Result>(_ body: (UnsafeBufferPointer<UInt8>) -> Result) -> Result {
+        guard let buffer = pactffi_fetch_log_buffer(nil) else {
+            return body(UnsafeBufferPointer(start: nil, count: 0))
+        }
+        defer { pactffi_string_delete(UnsafeMutablePointer(mutating: buffer)) }
+
+        let count = strlen(buffer)
+        return buffer.withMemoryRebound(to: UInt8.self, capacity: count) { bytes in
+            body(UnsafeBufferPointer(start: bytes, count: count))
+        }
+    }
+
+    /// Adds `lines` to the retained lines, dropping the oldest above `retainedLimit`. Must be called while holding `lock`.
+    func retain(_ lines: [String]) {
+        guard retainedLimit > 0 else {
+            return
+        }
+
+        retainedLines.append(contentsOf: lines)
+        retainedCount += lines.reduce(0) { $0 + $1.utf8.count }
+
+        guard retainedCount > retainedLimit else {
+            return
+        }
+
+        var dropCount = 0
+        while retainedCount > retainedLimit, dropCount < retainedLines.count {
+            retainedCount -= retainedLines[dropCount].utf8.count
+            dropCount += 1
+        }
+        retainedLines.removeFirst(dropCount)
+    }
+}
@@ -56,7 +56,6 @@ public enum Logging {
     /// Apply the previously configured sinks and levels to the program. If no sinks have been setup will set the log level to ``Level/info`` and the target to ``Sink/standardOut``.
     ///
     /// This function will install a global tracing subscriber. Any attempts to modify the logger after the call to `loggerApply()` will fail.
-    @MainActor
     private static func apply() throws {
         let result = pactffi_logger_apply()
         guard result == 0 else {
@@ -64,35 +63,22 @@ public enum Logging {
         }
     }
 
-    /// Initialize the logger with no sinks.
-    ///
-    /// This initialized logger does nothing until ``Logging/apply()`` has been called.
-    @MainActor
-    @discardableResult
-    private static func initialize() -> Bool {
-        guard isInitialized == false else {
-            return false
-        }
-
-        pactffi_logger_init()
-        isInitialized = true
-        return true
-    }
-
     /// Returns a value indicating whether the PactSwift ``Logging`` has been initialized.
-    @MainActor public private(set) static var isInitialized = false
+    public static var isInitialized: Bool {
+        initialization.isDone
+    }
 
     /// Initialize the Pact logging infrastructure.
     ///
-    /// You should call this early in the lifetime of your Pact test case.
-    /// Subsequent calls will do nothing.
+    /// You should call this early in the lifetime of your Pact test case. It can be called from any thread or task.
+    /// The first call configures the sinks; subsequent calls, including ones made while the first is still running,
+    /// do nothing.
     ///
     /// For example:
     ///
     /// ```swift
     /// class PactTests: XCTestCase {
     ///
-    ///   @MainActor
     ///   class override func setUp() {
     ///     super.setUp()
     ///     try! Logging.initialize()
@@ -106,23 +92,21 @@ public enum Logging {
     ///
     /// - Parameters:
     ///   - logSinks: An array of ``Logging/Sink/Config`` instances to configure the log sinks.
-    @MainActor
     public static func initialize(_ logSinks: [Logging.Sink.Config] = .defaultSinks) throws {
-        guard initialize() else {
-            return
-        }
-
-        for sink in logSinks {
-            try Logging.attachSink(sink.sink, filter: sink.filter)
+        try initialization.run {
+            pactffi_logger_init()
+            for sink in logSinks {
+                try Logging.attachSink(sink.sink, filter: sink.filter)
+            }
+            try Logging.apply()
+            router.coreFilter = logSinks.map(\.filter).max() ?? .off
         }
-        try Logging.apply()
     }
 
     /// Attach an additional sink to the thread-local logger.
     ///
     /// - Note: This logger does nothing until ``Logging/apply`` has been called.
     ///
-    @MainActor
     private static func attachSink(_ sink: Sink, filter: Filter) throws {
         let result = pactffi_logger_attach_sink(sink.specifier.cString(using: .utf8), LevelFilter(filter))
         guard result == 0 else {
@@ -131,6 +115,8 @@ public enum Logging {
     }
 
     /// Fetch the in-memory logger buffer contents. This will only have any contents if the ``Sink/buffer`` sink has been configured to log to.
+    ///
+    /// - Note: Every read returns the whole buffer. Use a ``LogCursor`` to read only what was logged since the previous read.
     public static var buffer: String {
         // Fetches the logs associated with the provided identifier, or uses the "global" one if the identifier is not specified (i.e. NULL).
         guard let buffer = pactffi_fetch_log_buffer(nil) else {
@@ -141,16 +127,50 @@ public enum Logging {
         return String(cString: buffer)
     }
 
+    /// Whether a message logged at `level` reaches at least one of the configured sinks.
+    ///
+    /// Before ``initialize(_:)`` has configured the sinks no message does.
+    ///
+    public static func isEnabled(_ level: Level) -> Bool {
+        level.rank <= router.routes.filter.rank
+    }
+
     /// Log using the shared Pact core logging facility.
     ///
-    /// This is useful for callers to have a single set of logs.
+    /// This is useful for callers to have a single set of logs. A message below the most verbose configured
+    /// sink filter is dropped without evaluating `message` or calling into the Pact core.
     ///
     /// - Parameters:
     ///   - level: The log level to use.
     ///   - message: The message to log.
     ///
-    public static func log(_ level: Level, message: String) {
-        pactffi_log_message("pact_swift".cString(using: .utf8), level.rawValue.cString(using: .utf8), message.cString(using: .utf8))
+    public static func log(_ level: Level, message: @autoclosure () -> String) {
+        let routes = router.routes
+        guard level.rank <= routes.filter.rank else {
+            return
+        }
+
+        let message = message()
+        for sink in routes.messageSinks where level.rank <= (sink.messageFilter ?? .off).rank {
+            sink.record(level, message: message)
+        }
+
+        guard level.rank <= routes.coreFilter.rank else {
+            return
+        }
+        withUTF8CStrings("pact_swift", level.rawValue, message) { source, level, message in
+            pactffi_log_message(source, level, message)
+        }
+    }
+
+    /// Starts handing messages to `sink`.
+    internal static func addMessageSink(_ sink: FileLogSink) {
+        router.messageSinks.append(sink)
+    }
+
+    /// Stops handing messages to `sink`.
+    internal static func removeMessageSink(_ sink: FileLogSink) {
+        router.messageSinks.removeAll { $0 === sink }
     }
 
     /// Get the last error message from the underlying `pact_ffi` library.
@@ -183,6 +203,97 @@ public enum Logging {
     }
 }
 
+// MARK: - Private
+
+private extension Logging {
+
+    /// Where messages at each level are logged to.
+    struct Routes {
+
+        /// The most verbose filter of the Pact core sinks.
+        var coreFilter = Filter.off
+
+        /// The sinks taking messages without going through the Pact core.
+        var messageSinks: [FileLogSink] = []
+
+        /// The most verbose filter of every sink.
+        var filter: Filter {
+            messageSinks.compactMap(\.messageFilter).reduce(coreFilter, max)
+        }
+    }
+
+    /// Holds the ``Routes``, with the most verbose filter worked out once whenever they change.
+    final class Router: @unchecked Sendable {
+        private let lock = NSLock()
+        private var current = (routes: Routes(), filter: Filter.off)
+
+        /// The current routes, and their most verbose filter.
+        var routes: (coreFilter: Filter, messageSinks: [FileLogSink], filter: Filter) {
+            lock.lock()
+            defer { lock.unlock() }
+
+            return (current.routes.coreFilter, current.routes.messageSinks, current.filter)
+        }
+
+        var coreFilter: Filter {
+            get { routes.coreFilter }
+            set { update { $0.coreFilter = newValue } }
+        }
+
+        var messageSinks: [FileLogSink] {
+            get { routes.messageSinks }
+            set { update { $0.messageSinks = newValue } }
+        }
+
+        private func update(_ change: (inout Routes) -> Void) {
+            lock.lock()
+            defer { lock.unlock() }
+
+            change(&current.routes)
+            current.filter = current.routes.filter
+        }
+    }
+
+    static let router = Router()
+
+    static let initialization = Once()
+}
+
+extension Logging.Filter: Comparable {
+
+    /// Orders filters from the least to the most verbose.
+    public static func < (lhs: Self, rhs: Self) -> Bool {
+        lhs.rank < rhs.rank
+    }
+}
+
+private extension Logging.Filter {
+    var rank: Int {
+        switch self {
+        case .off: return 0
+        case .error: return 1
+        case .warn: return 2
+        case .info: return 3
+        case .debug: return 4
+        case .trace: return 5
+        }
+    }
+}
+
+private extension Logging.Level {
+
+    /// The rank of the least verbose ``Logging/Filter`` letting messages at this level through.
+    var rank: Int {
+        switch self {
+        case .error: return 1
+        case .warn: return 2
+        case .info: return 3
+        case .debug: return 4
+        case .trace: return 5
+        }
+    }
+}
+
 private extension LevelFilter {
     init(_ levelFilter: Logging.Filter) {
         switch levelFilter {
@@ -221,8 +332,9 @@ public extension Array where Element == Logging.Sink.Config {
     /// recording the match when `pactffi_mock_server_matched` is polled — the interaction then gets
     /// reported as a missing request even though it matched.
     ///
-    /// - Note: Raise this to `trace` only when
-    /// debugging the Pact library itself, and expect binary body interactions to be flaky if you do.
+    /// - Note: Raise this to `trace` only when debugging the Pact library itself. When you do, set
+    /// ``PactBuilder/Config/quiescence`` or call ``MockServer/awaitQuiescence(_:)`` before verifying so
+    /// binary body interactions have finished recording.
     ///
     static let defaultSinks: Self = [
         Element(.standardError, filter: .info),
@@ -0,0 +1,241 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// A JSON example value, optionally with the matching rule it is verified with.
+///
+/// Matchers describe a body in Swift instead of a hand-written
+/// [IntegrationJson](https://github.com/pact-foundation/pact-reference/blob/master/rust/pact_ffi/IntegrationJson.md)
+/// string. Plain values are matched by equality; wrap them in a matcher such as ``like(_:)`` or ``regex(_:example:)``
+/// to relax the match. A tree of matchers is serialised into a ``MatchingBody``.
+///
+/// ```swift
+/// let body = MatchingBody {
+///     ("id", .integer(1))
+///     ("name", .like("Mary"))
+///     ("createdAt", .datetime("yyyy-MM-dd'T'HH:mm:ss", example: "2026-10-17T09:00:00"))
+///     ("tags", .eachLike("admin"))
+/// }
+/// ```
+///
+public struct Matcher: Hashable, Sendable {
+
+    /// A named member of a JSON object.
+    public struct Member: Hashable, Sendable {
+        let name: String
+        let node: Node
+
+        /// - Parameters:
+        ///   - name: The member name.
+        ///   - matcher: The member value.
+        public init(_ name: String, _ matcher: Matcher) {
+            self.name = name
+            self.node = matcher.node
+        }
+    }
+
+    indirect enum Node: Hashable, Sendable {
+        case null
+        case bool(Bool)
+        case integer(Int)
+        case decimal(Double)
+        case string(String)
+        case array([Node])
+        case object([Member])
+        case rule(type: String, attributes: [Member], example: Node)
+    }
+
+    let node: Node
+
+    init(_ node: Node) {
+        self.node = node
+    }
+
+    // MARK: - Interface
+
+    /// A JSON object with `members`.
+    public static func object(@ObjectBuilder _ members: () -> [Member]) -> Matcher {
+        Matcher(.object(members()))
+    }
+
+    /// A JSON array with `elements`.
+    public static func array(@ArrayBuilder _ elements: () -> [Matcher]) -> Matcher {
+        Matcher(.array(elements().map(\.node)))
+    }
+
+    /// Matches any value of the same type as `example`.
+    public static func like(_ example: Matcher) -> Matcher {
+        rule("type", example: example.node)
+    }
+
+    /// Matches an array where every element is like `example`.
+    ///
+    /// - Parameters:
+    ///   - example: The example element.
+    ///   - min: The minimum number of elements. Defaults to `1`.
+    ///   - max: The maximum number of elements, or `nil` for no upper bound.
+    ///
+    public static func eachLike(_ example: Matcher, min: Int = 1, max: Int? = nil) -> Matcher {
+        var attributes = [Member("min", Matcher(.integer(min)))]
+        if let max = max {
+            attributes.append(Member("max", Matcher(.integer(max))))
+        }
+        return rule("type", attributes: attributes, example: .array([example.node]))
+    }
+
+    /// Matches a string against the regular expression `pattern`.
+    public static func regex(_ pattern: String, example: String) -> Matcher {
+        rule("regex", attributes: [Member("regex", Matcher(.string(pattern)))], example: .string(example))
+    }
+
+    /// Matches a date and time string in `format`, using the Java `DateTimeFormatter` pattern syntax.
+    public static func datetime(_ format: String, example: String) -> Matcher {
+        rule("datetime", attributes: [Member("format", Matcher(.string(format)))], example: .string(example))
+    }
+
+    /// Matches a date string in `format`, using the Java `DateTimeFormatter` pattern syntax.
+    public static func date(_ format: String, example: String) -> Matcher {
+        rule("date", attributes: [Member("format", Matcher(.string(format)))], example: .string(example))
+    }
+
+    /// Matches a time string in `format`, using the Java `DateTimeFormatter` pattern syntax.
+    public static func time(_ format: String, example: String) -> Matcher {
+        rule("time", attributes: [Member("format", Matcher(.string(format)))], example: .string(example))
+    }
+
+    /// Matches any integer.
+    public static func integer(_ example: Int) -> Matcher {
+        rule("integer", example: .integer(example))
+    }
+
+    /// Matches any decimal number.
+    public static func decimal(_ example: Double) -> Matcher {
+        rule("decimal", example: .decimal(example))
+    }
+
+    /// Matches any boolean.
+    public static func boolean(_ example: Bool) -> Matcher {
+        rule("boolean", example: .bool(example))
+    }
+
+    /// Matches a value equal to `example`, resetting any matching rule inherited from an enclosing matcher.
+    public static func equal(to example: Matcher) -> Matcher {
+        rule("equality", example: example.node)
+    }
+
+    /// Matches a string that contains `substring`.
+    public static func includes(_ substring: String) -> Matcher {
+        rule("include", example: .string(substring))
+    }
+}
+
+// MARK: - Result builders
+
+public extension Matcher {
+
+    /// Collects the members of a JSON object, written as `(name, matcher)` pairs.
+    @resultBuilder
+    enum ObjectBuilder {
+        public static func buildExpression(_ member: (String, Matcher)) -> [Member] {
+            [Member(member.0, member.1)]
+        }
+
+        public static func buildExpression(_ member: Member) -> [Member] {
+            [member]
+        }
+
+        public static func buildBlock(_ components: [Member]...) -> [Member] {
+            components.flatMap { $0 }
+        }
+
+        public static func buildOptional(_ component: [Member]?) -> [Member] {
+            component ?? []
+        }
+
+        public static func buildEither(first component: [Member]) -> [Member] {
+            component
+        }
+
+        public static func buildEither(second component: [Member]) -> [Member] {
+            component
+        }
+
+        public static func buildArray(_ components: [[Member]]) -> [Member] {
+            components.flatMap { $0 }
+        }
+    }
+
+    /// Collects the elements of a JSON array.
+    @resultBuilder
+    enum ArrayBuilder {
+        public static func buildExpression(_ element: Matcher) -> [Matcher] {
+            [element]
+        }
+
+        public static func buildBlock(_ components: [Matcher]...) -> [Matcher] {
+            components.flatMap { $0 }
+        }
+
+        public static func buildOptional(_ component: [Matcher]?) -> [Matcher] {
+            component ?? []
+        }
+
+        public static func buildEither(first component: [Matcher]) -> [Matcher] {
+            component
+        }
+
+        public static func buildEither(second component: [Matcher]) -> [Matcher] {
+            component
+        }
+
+        public static func buildArray(_ components: [[Matcher]]) -> [Matcher] {
+            components.flatMap { $0 }
+        }
+    }
+}
+
+// MARK: - Literals
+
+extension Matcher: ExpressibleByStringLiteral {
+    public init(stringLiteral value: String) {
+        self.init(.string(value))
+    }
+}
+
+extension Matcher: ExpressibleByIntegerLiteral {
+    public init(integerLiteral value: Int) {
+        self.init(.integer(value))
+    }
+}
+
+extension Matcher: ExpressibleByFloatLiteral {
+    public init(floatLiteral value: Double) {
+        self.init(.decimal(value))
+    }
+}
+
+extension Matcher: ExpressibleByBooleanLiteral {
+    public init(booleanLiteral value: Bool) {
+        self.init(.bool(value))
+    }
+}
+
+extension Matcher: ExpressibleByNilLiteral {
+    public init(nilLiteral: ()) {
+        self.init(.null)
+    }
+}
+
+// MARK: - Private
+
+private extension Matcher {
+
+    static func rule(_ type: String, attributes: [Member] = [], example: Node) -> Matcher {
+        Matcher(.rule(type: type, attributes: attributes, example: example))
+    }
+}
@@ -0,0 +1,227 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// A JSON body with embedded matching rules, serialised once from a ``Matcher`` tree.
+///
+/// The IntegrationJson is written into a NUL terminated buffer when the body is created and handed to the
+/// Pact FFI as is, so configuring an interaction with it doesn't build any strings. Identical matcher trees
+/// share one buffer while it is among the most recently used 8 MiB of bodies. Create a body once, for example
+/// in a `static let`, and reuse it.
+///
+/// ```swift
+/// static let user = MatchingBody {
+///     ("id", .integer(1))
+///     ("name", .like("Mary"))
+/// }
+///
+/// try response.body(Self.user)
+/// ```
+///
+public struct MatchingBody: Sendable {
+
+    /// The serialised IntegrationJson.
+    final class Buffer: Sendable {
+        let bytes: [CChar]
+
+        init(_ bytes: [CChar]) {
+            self.bytes = bytes
+        }
+    }
+
+    let buffer: Buffer
+
+    /// - Parameters:
+    ///   - matcher: The body.
+    public init(_ matcher: Matcher) {
+        buffer = Self.buffer(for: matcher)
+    }
+
+    /// - Parameters:
+    ///   - members: The members of the top level JSON object.
+    public init(@Matcher.ObjectBuilder _ members: () -> [Matcher.Member]) {
+        self.init(Matcher.object(members))
+    }
+
+    // MARK: - Interface
+
+    /// The IntegrationJson the body is serialised into.
+    public var json: String {
+        String(decoding: buffer.bytes.dropLast().lazy.map { UInt8(bitPattern: $0) }, as: UTF8.self)
+    }
+
+    /// The buffers shared between bodies created from identical matcher trees.
+    static let cache = BufferCache()
+
+    /// Calls `body` with the NUL terminated IntegrationJson.
+    func withCString<Result>(_ body: (UnsafePointer<CChar>) throws -> Result) rethrows -> Result {
+        try body(buffer.bytes)
+    }
+}
+
+// MARK: - Private
+
+private extension MatchingBody {
+
+    static func buffer(for matcher: Matcher) -> Buffer {
+        cache.buffer(for: matcher)
+    }
+}
+
+/// The process wide serialised buffers, keyed by their matcher tree.
+///
+/// The least recently used buffers are dropped once the cached bytes exceed ``byteLimit``. Bodies already
+/// created keep their buffer; only sharing it with bodies created later is lost.
+final class BufferCache: @unchecked Sendable {
+
+    /// The maximum number of bytes of buffers kept.
+    let byteLimit: Int
+
+    private struct Entry {
+        let buffer: MatchingBody.Buffer
+        var lastUse: Int
+    }
+
+    private let lock = NSLock()
+    private var entries: [Matcher: Entry] = [:]
+    private var byteCount = 0
+    private var useCount = 0
+
+    init(byteLimit: Int = 8 * 1_024 * 1_024) {
+        self.byteLimit = byteLimit
+    }
+
+    /// The number of bytes of buffers currently kept.
+    var cachedBytes: Int {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return byteCount
+    }
+
+    /// The shared buffer for `matcher`, serialising it when the tree isn't cached.
+    func buffer(for matcher: Matcher) -> MatchingBody.Buffer {
+        lock.lock()
+        if let buffer = entries[matcher]?.buffer {
+            useCount += 1
+            entries[matcher]?.lastUse = useCount
+            lock.unlock()
+            return buffer
+        }
+        lock.unlock()
+
+        // Serialised outside the lock; a racing insert of the same tree wins and this buffer is dropped.
+        var writer = JSONWriter()
+        writer.write(matcher.node)
+        let buffer = MatchingBody.Buffer(writer.finish())
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        useCount += 1
+        if let existing = entries[matcher]?.buffer {
+            entries[matcher]?.lastUse = useCount
+            return existing
+        }
+        guard buffer.bytes.count <= byteLimit else {
+            return buffer
+        }
+
+        entries[matcher] = Entry(buffer: buffer, lastUse: useCount)
+        byteCount += buffer.bytes.count
+        evictIfNeeded()
+        return buffer
+    }
+
+    /// Drops the least recently used buffers above `byteLimit`. Must be called while holding `lock`.
+    private func evictIfNeeded() {
+        while byteCount > byteLimit, let (matcher, entry) = entries.min(by: { $0.value.lastUse < $1.value.lastUse }) {
+            entries[matcher] = nil
+            byteCount -= entry.buffer.bytes.count
+        }
+    }
+}
+
+/// Writes a ``Matcher/Node`` tree as IntegrationJson straight into UTF-8 bytes.
+private struct JSONWriter {
+
+    private var bytes: [CChar] = []
+
+    mutating func write(_ node: Matcher.Node) {
+        switch node {
+        case .null:
+            append("null")
+        case let .bool(value):
+            append(value ? "true" : "false")
+        case let .integer(value):
+            append(String(value))
+        case let .decimal(value):
+            precondition(value.isFinite, "JSON can't represent \(value)!")
+            append(String(value))
+        case let .string(value):
+            writeString(value)
+        case let .array(elements):
+            append("[")
+            for (index, element) in elements.enumerated() {
+                if index > 0 {
+                    append(",")
+                }
+                write(element)
+            }
+            append("]")
+        case let .object(members):
+            writeObject(members)
+        case let .rule(type, attributes, example):
+            writeObject(
+                [Matcher.Member("pact:matcher:type", Matcher(.string(type)))]
+                    + attributes
+                    + [Matcher.Member("value", Matcher(example))]
+            )
+        }
+    }
+
+    mutating func finish() -> [CChar] {
+        bytes.append(0)
+        return bytes
+    }
+
+    private mutating func writeObject(_ members: [Matcher.Member]) {
+        append("{")
+        for (index, member) in members.enumerated() {
+            if index > 0 {
+                append(",")
+            }
+            writeString(member.name)
+            append(":")
+            write(member.node)
+        }
+        append("}")
+    }
+
+    private mutating func writeString(_ string: String) {
+        append("\"")
+        for scalar in string.unicodeScalars {
+            switch scalar {
+            case "\"": append("\\\"")
+            case "\\": append("\\\\")
+            case "\n": append("\\n")
+            case "\r": append("\\r")
+            case "\t": append("\\t")
+            case let scalar where scalar.value < 0x20:
+                append(String(format: "\\u%04x", scalar.value))
+            default:
+                bytes.append(contentsOf: String(scalar).utf8.map { CChar(bitPattern: $0) })
+            }
+        }
+        append("\"")
+    }
+
+    private mutating func append(_ string: String) {
+        bytes.append(contentsOf: string.utf8.map { CChar(bitPattern: $0) })
+    }
+}
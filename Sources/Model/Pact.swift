@@ -54,6 +54,21 @@ public final class Pact {
 
     internal let handle: PactHandle
 
+    /// The interactions created on this Pact.
+    internal private(set) var interactions: [Interaction] = []
+
+    /// The registry sharing this Pact, if it was created by one.
+    internal weak var registry: PactRegistry?
+
+    /// Whether a mock server was started for this Pact, after which the Pact core refuses any change to it.
+    internal var hasStartedMockServer = false
+
+    /// The calls that configured this Pact itself, rather than one of its interactions.
+    private let fingerprint = Fingerprint()
+
+    /// The metadata set on this Pact, in the order it was set.
+    private var metadata: [(namespace: String, name: String, value: String)] = []
+
     private let ffiProvider: PactFFIProviding
 
     public var filename: String {
@@ -77,6 +92,7 @@ public final class Pact {
     /// Throws ``Error/canNotBeModified`` if Pact can’t be modified (i.e. the mock server for it has already started).
     public func withSpecification(_ specification: Specification) throws -> Self {
         try ffiProvider.withSpecification(handle: handle, version: specification)
+        fingerprint.record("withSpecification", specification)
 
         return self
     }
@@ -92,6 +108,8 @@ public final class Pact {
     ///   - value: A value to set.
     public func withMetadata(namespace: String, name: String, value: String) throws -> Self {
         try ffiProvider.withMetadata(handle: handle, namespace: namespace, key: name, value: value)
+        fingerprint.record("withMetadata", namespace, name, value)
+        metadata.append((namespace, name, value))
         return self
     }
 
@@ -99,7 +117,24 @@ public final class Pact {
     ///
     /// - parameter description - The interaction description. It needs to be unique for each interaction.
     internal func uponReceiving(_ description: String) -> Interaction {
-        Interaction(pactHandle: handle, description: description)
+        let interaction = Interaction(pactHandle: handle, description: description)
+        interactions.append(interaction)
+
+        return interaction
+    }
+
+    /// Creates an empty Pact for the same consumer and provider, with this Pact's specification and metadata.
+    ///
+    /// The sibling is written to the same Pact file as this Pact.
+    ///
+    /// - Throws: ``Error/canNotBeModified`` if the specification or metadata can't be set on the sibling.
+    ///
+    internal func makeSibling() throws -> Pact {
+        let sibling = try Pact(consumer: consumer, provider: provider).withSpecification(specVersion)
+        for (namespace, name, value) in metadata {
+            _ = try sibling.withMetadata(namespace: namespace, name: name, value: value)
+        }
+        return sibling
     }
 
     /// Write out the pact file.
@@ -116,6 +151,31 @@ public final class Pact {
         try ffiProvider.writePactFile(handle: handle, to: writeDirectory, overwrite: overwrite)
         Logging.log(.info, message: "Wrote pact to '\(writeDirectory)/\(filename)'")
     }
+
+    /// Identifies the contract configured on this Pact without serialising it.
+    ///
+    /// Two Pacts whose interactions were all created with ``uponReceiving(_:)`` and configured with the same calls
+    /// in the same order have equal contract fingerprints.
+    ///
+    internal var contractFingerprint: AnyHashable {
+        [consumer, provider, fingerprint.calls, interactions.map(\.fingerprint.calls)] as [AnyHashable]
+    }
+
+    /// The serialised Pact contract as currently registered on the handle.
+    ///
+    /// The contract is written to a scratch directory and read back, so two Pacts with the same
+    /// consumer, provider, metadata and interactions produce identical contents.
+    ///
+    /// - Throws: ``Error/canNotWritePact(_:)`` if the contract could not be serialised.
+    ///
+    internal func contents() throws -> Data {
+        let scratchDirectory = FileManager.default.temporaryDirectory
+            .appendingPathComponent("pact-swift-\(UUID().uuidString)", isDirectory: true)
+        defer { try? FileManager.default.removeItem(at: scratchDirectory) }
+
+        try ffiProvider.writePactFile(handle: handle, to: scratchDirectory.path, overwrite: true)
+        return try Data(contentsOf: scratchDirectory.appendingPathComponent(filename))
+    }
 }
 
 extension Pact.Error: LocalizedError {
@@ -0,0 +1,152 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// The failures recorded by a ``MockServer``, decoded one at a time as the sequence is iterated.
+///
+/// The failures are read straight from the mismatches buffer of the mock server, which the sequence keeps
+/// alive. Only the elements that are iterated are decoded, and each at most once, so finding the first failure
+/// of a given type stops decoding as soon as it is found:
+///
+/// ```swift
+/// let missing = mockServer.failures.ofType(.missing).first { $0.path == "/users" }
+/// ```
+///
+/// - Note: An element that fails to decode is logged as an error and yielded as a failure of type
+/// ``PactVerificationFailure/FailureType/mockServerParsingFail``, whatever type the sequence is filtered by,
+/// so a malformed mismatch is never mistaken for the end of the failures. If the mismatches are not a JSON array
+/// the iteration ends after that failure. Use ``MockServer/verificationFailures(limit:)`` to have decoding errors
+/// thrown instead.
+///
+/// - Important: The buffer is released when the mock server is shut down. Iterating the sequence after
+/// ``MockServer/shutdown()`` yields nothing.
+///
+public struct PactVerificationFailures: Sequence {
+
+    /// Where the mismatches JSON is read from.
+    enum Source {
+        /// The mismatches buffer of `mockServer`, owned by the Pact core.
+        case mockServer(MockServer, UnsafeBufferPointer<UInt8>)
+
+        /// A copy of the mismatches JSON.
+        case json(Data)
+    }
+
+    private let source: Source
+    private let type: PactVerificationFailure.FailureType?
+
+    init(source: Source, type: PactVerificationFailure.FailureType? = nil) {
+        self.source = source
+        self.type = type
+    }
+
+    init(json: Data) {
+        self.init(source: .json(json))
+    }
+
+    // MARK: - Interface
+
+    /// The failures of `type` only.
+    ///
+    /// The type of each failure is found while scanning for it, so failures of any other type are skipped
+    /// without decoding them.
+    ///
+    public func ofType(_ type: PactVerificationFailure.FailureType) -> PactVerificationFailures {
+        PactVerificationFailures(source: source, type: type)
+    }
+
+    public func makeIterator() -> Iterator {
+        Iterator(source: source, type: type)
+    }
+
+    public struct Iterator: IteratorProtocol {
+
+        private let source: Source
+        private let type: [UInt8]?
+        private let decoder = JSONDecoder()
+        private var scanner = MismatchesDecoder.ElementScanner()
+        private var isFinished = false
+
+        fileprivate init(source: Source, type: PactVerificationFailure.FailureType?) {
+            self.source = source
+            self.type = type.map { Array($0.rawValue.utf8) }
+        }
+
+        public mutating func next() -> PactVerificationFailure? {
+            guard isFinished == false else {
+                return nil
+            }
+
+            do {
+                if let failure = try decodeNext() {
+                    return failure
+                }
+            } catch {
+                // The scanner can't find the next element once the array itself is malformed.
+                isFinished = true
+                return parsingFailure(error)
+            }
+
+            isFinished = true
+            return nil
+        }
+    }
+}
+
+// MARK: - Private
+
+private extension PactVerificationFailures.Iterator {
+
+    mutating func decodeNext() throws -> PactVerificationFailure? {
+        switch source {
+        case let .mockServer(mockServer, buffer):
+            return try mockServer.withMismatches(buffer) { bytes in
+                guard let bytes = bytes else {
+                    Logging.log(.error, message: "Mock server on port \(mockServer.port) was shut down before its failures were read")
+                    return nil
+                }
+                return try decodeNext(in: bytes)
+            }
+        case let .json(json):
+            return try json.withUnsafeBytes { raw in
+                try decodeNext(in: raw.bindMemory(to: UInt8.self))
+            }
+        }
+    }
+
+    mutating func decodeNext(in bytes: UnsafeBufferPointer<UInt8>) throws -> PactVerificationFailure? {
+        guard let baseAddress = bytes.baseAddress else {
+            return nil
+        }
+
+        while let element = try scanner.next(in: bytes) {
+            // Types are plain strings, so the raw bytes are compared without unescaping them.
+            if let type = type, let elementType = element.type, bytes[elementType].elementsEqual(type) == false {
+                continue
+            }
+
+            let data = Data(
+                bytesNoCopy: UnsafeMutableRawPointer(mutating: baseAddress + element.range.lowerBound),
+                count: element.range.count,
+                deallocator: .none
+            )
+            do {
+                return try decoder.decode(PactVerificationFailure.self, from: data)
+            } catch {
+                // The scanner has already moved past the element, so iteration carries on with the next one.
+                return parsingFailure(error)
+            }
+        }
+        return nil
+    }
+
+    func parsingFailure(_ error: Error) -> PactVerificationFailure {
+        Logging.log(.error, message: "Failed to decode mock server mismatches: \(error.localizedDescription)")
+        return PactVerificationFailure(type: .mockServerParsingFail, method: "", path: "", request: nil, mismatches: [])
+    }
+}
@@ -28,31 +28,125 @@ public final class PactBuilder {
         /// The directory in to which Pacts are written.
         public let pactDirectory: String
 
-        public init(pactDirectory: String) {
+        /// The pool to take mock servers from. When `nil` a new mock server is started for every verification.
+        public let mockServerPool: MockServerPool?
+
+        /// When set, asynchronous verifications wait for the mock server to become quiescent before verifying.
+        public let quiescence: MockServer.Quiescence?
+
+        /// The maximum number of failures reported when a verification fails. When `nil` every failure is reported.
+        public let failureLimit: Int?
+
+        /// The writer to write Pact files in the background with. When `nil` Pact files are written on the verifying thread.
+        public let pactFileWriter: PactFileWriter?
+
+        /// When `true` Pact files are written to this process' shard of ``pactDirectory``, to be combined with
+        /// ``PactShards/merge(pactDirectory:removeShards:)`` once every test process has finished.
+        public let sharded: Bool
+
+        public init(
+            pactDirectory: String,
+            mockServerPool: MockServerPool? = nil,
+            quiescence: MockServer.Quiescence? = nil,
+            failureLimit: Int? = nil,
+            pactFileWriter: PactFileWriter? = nil,
+            sharded: Bool = false
+        ) {
             self.pactDirectory = pactDirectory
+            self.mockServerPool = mockServerPool
+            self.quiescence = quiescence
+            self.failureLimit = failureLimit
+            self.pactFileWriter = pactFileWriter
+            self.sharded = sharded
+        }
+
+        /// The directory Pact files are written to by this process.
+        internal var outputDirectory: String {
+            sharded ? PactShards.directory(in: pactDirectory) : pactDirectory
         }
     }
 
     private let pact: Pact
     private let config: Config
 
+    /// The Pacts hosting the interactions of each test, keyed by test name.
+    private var testPacts: [String: Pact] = [:]
+
+    /// The mock servers started up front for tests that have not been verified yet, keyed by test name.
+    private var testMockServers: [String: MockServer] = [:]
+    private var testTransferProtocol: MockServer.TransferProtocol = .standard
+    private var verifiedTests: Set<String> = []
+    private var testVerificationFailed = false
+
+    /// The interactions created by this builder since its last verification.
+    private var pendingInteractions: [Interaction] = []
+
     public init(pact: Pact, config: Config) {
         self.pact = pact
         self.config = config
     }
 
+    /// The file name of the Pact contract being built.
+    internal var pactFilename: String {
+        pact.filename
+    }
+
     /// Create a new `Interaction`.
     ///
     /// - parameter description - The interaction description. It needs to be unique for each interaction.
     public func uponReceiving(_ description: String) -> Interaction {
-        pact.uponReceiving(description)
+        let interaction = pact.uponReceiving(description)
+        pendingInteractions.append(interaction)
+
+        return interaction
+    }
+
+    /// Create a new `Interaction` from a precompiled ``InteractionTemplate``.
+    ///
+    /// - Throws: ``Interaction/Error`` if the interaction or Pact can't be modified (i.e. the mock server for it has already started)
+    ///
+    /// - Parameters:
+    ///   - template: The template to stamp.
+    ///   - parameters: The values to replace the template's `{{name}}` placeholders with.
+    ///
+    @discardableResult
+    public func uponReceiving(_ template: InteractionTemplate, parameters: [String: String] = [:]) throws -> Interaction {
+        let interaction = try template.stamp(into: pact, parameters: parameters)
+        pendingInteractions.append(interaction)
+
+        return interaction
+    }
+
+    /// Create a new `Interaction` verified only by the test named `testName`.
+    ///
+    /// The interaction is registered on a Pact of its own for the test, with the same consumer, provider,
+    /// specification and metadata, so it is hosted by the test's own mock server. See ``verify(testName:handler:)``.
+    ///
+    /// - Throws: ``Interaction/Error`` if the interaction can't be tagged with `testName`.
+    ///
+    /// - Parameters:
+    ///   - description: The interaction description. It needs to be unique for each interaction.
+    ///   - testName: The name of the test verifying the interaction.
+    ///
+    /// - Warning: This can only be used with `PactSpecification.v4` Pacts.
+    ///
+    public func uponReceiving(_ description: String, testName: String) throws -> Interaction {
+        let testPact: Pact
+        if let existing = testPacts[testName] {
+            testPact = existing
+        } else {
+            testPact = try pact.makeSibling()
+            testPacts[testName] = testPact
+        }
+
+        return try testPact.uponReceiving(description).testName(testName)
     }
 
     /// Verify the configured interactions.
     ///
     /// - Throws: An ``Error/pactFailure(_:)`` if the pact fails to verify or a ``MockServer/Error`` if the mock server fails.
     public func verify(handler: (ConsumerContext) throws -> Void) throws {
-        let mockServer = try MockServer(pact: pact, transferProtocol: .standard)
+        let mockServer = try makeMockServer()
 
         try handler(ConsumerContext(mockServerURL: mockServer.baseUrl))
 
@@ -61,25 +155,319 @@ public final class PactBuilder {
 
     /// Verify the configured interactions.
     ///
+    /// The mock server is started, verified and shut down on a dedicated executor so the blocking Pact FFI
+    /// calls never occupy a Swift concurrency thread.
+    ///
     /// - Throws: An ``Error/pactFailure(_:)`` if the pact fails to verify or a ``MockServer/Error`` if the mock server fails.
     public func verify(handler: @Sendable (ConsumerContext) async throws -> Void) async throws {
-        let mockServer = try MockServer(pact: pact, transferProtocol: .standard)
+        let mockServer = try await makeMockServerAsync()
+
+        do {
+            try await handler(ConsumerContext(mockServerURL: mockServer.baseUrl))
+            await awaitQuiescenceIfNeeded(mockServer)
+            try await FFIExecutor.run { try self.verifyInternal(mockServer: mockServer) }
+        } catch {
+            await release(mockServer)
+            throw error
+        }
+        await release(mockServer)
+    }
+
+    // MARK: - Per-test mock servers
+
+    /// Starts the mock server of every test registered with ``uponReceiving(_:testName:)`` up front.
+    ///
+    /// Use this to take mock server start-up off the critical path of each test in a suite. Register every
+    /// interaction up front with ``uponReceiving(_:testName:)``, then verify each test with
+    /// ``verify(testName:handler:)``. Each test has a mock server of its own, hosting only its interactions,
+    /// so failures are never attributed to the wrong test. Interactions can not be added to a test once its
+    /// mock server has started.
+    ///
+    /// ```swift
+    /// override class func setUp() {
+    ///     try builder.uponReceiving("a request for events", testName: "testGetEvents")
+    ///         .withRequest(path: "/events")
+    ///         .willRespond(with: 200)
+    ///     // ... other interactions ...
+    ///     try builder.startMockServer()
+    /// }
+    ///
+    /// override class func tearDown() {
+    ///     try builder.stopMockServer()
+    /// }
+    /// ```
+    ///
+    /// - Throws: A ``MockServer/Error`` if a mock server fails to start.
+    ///
+    /// - Parameters:
+    ///   - transferProtocol: The protocol to use when communicating with the mock servers; defaults to `.standard`.
+    ///
+    public func startMockServer(transferProtocol: MockServer.TransferProtocol = .standard) throws {
+        testTransferProtocol = transferProtocol
+        for (testName, testPact) in testPacts where testMockServers[testName] == nil && verifiedTests.contains(testName) == false {
+            testMockServers[testName] = try MockServer(pact: testPact, transferProtocol: transferProtocol)
+        }
+    }
+
+    /// Verify the interactions registered for `testName` with ``uponReceiving(_:testName:)``.
+    ///
+    /// The test's mock server is taken from those started by ``startMockServer(transferProtocol:)``, or
+    /// started now, and shut down once verified.
+    ///
+    /// - Throws: An ``Error/pactFailure(_:)`` if the test's interactions fail to verify or a ``MockServer/Error``
+    /// if the mock server fails.
+    ///
+    /// - Precondition: At least one interaction was registered for `testName`.
+    ///
+    public func verify(testName: String, handler: (ConsumerContext) throws -> Void) throws {
+        let mockServer = try takeTestMockServer(for: testName)
+
+        try handler(ConsumerContext(mockServerURL: mockServer.baseUrl))
+
+        try verifyInternal(mockServer: mockServer, testName: testName)
+    }
+
+    /// Verify the interactions registered for `testName` with ``uponReceiving(_:testName:)``.
+    ///
+    /// The test's mock server is taken from those started by ``startMockServer(transferProtocol:)``, or
+    /// started now, and shut down once verified.
+    ///
+    /// - Throws: An ``Error/pactFailure(_:)`` if the test's interactions fail to verify or a ``MockServer/Error``
+    /// if the mock server fails.
+    ///
+    /// - Precondition: At least one interaction was registered for `testName`.
+    ///
+    public func verify(testName: String, handler: @Sendable (ConsumerContext) async throws -> Void) async throws {
+        let mockServer = try takeTestMockServer(for: testName)
+
+        do {
+            try await handler(ConsumerContext(mockServerURL: mockServer.baseUrl))
+            await awaitQuiescenceIfNeeded(mockServer)
+            try await FFIExecutor.run { try self.verifyInternal(mockServer: mockServer, testName: testName) }
+        } catch {
+            await release(mockServer)
+            throw error
+        }
+        await release(mockServer)
+    }
+
+    /// Shuts down the mock servers of tests that were not verified and writes the Pact file if every verified test succeeded.
+    ///
+    /// Only the interactions of verified tests are written. A configured ``PactFileWriter`` is flushed, so the Pact
+    /// files written by earlier verifications are on disk too.
+    ///
+    /// - Throws: A ``Pact/Error`` if the Pact file could not be written, or the first error the configured
+    /// ``PactFileWriter`` failed to write a Pact file with.
+    ///
+    public func stopMockServer() throws {
+        testMockServers.removeAll()
+
+        let verified = verifiedTests.sorted()
+        let failed = testVerificationFailed
+        verifiedTests.removeAll()
+        testVerificationFailed = false
+
+        guard failed == false else {
+            Logging.log(.info, message: "Not writing pact file as at least one test failed verification")
+            try config.pactFileWriter?.flush()
+            return
+        }
+        for testName in verified {
+            if let testPact = testPacts[testName] {
+                try writePactFile(testPact)
+            }
+        }
+        try config.pactFileWriter?.flush()
+    }
+
+    // MARK: - Internal
 
-        try await handler(ConsumerContext(mockServerURL: mockServer.baseUrl))
+    /// Starts the mock server for a verification whose steps are run by a caller isolating the builder itself.
+    ///
+    /// ``PactSession`` runs the steps on its actor, so the builder is never used from two places at once.
+    ///
+    internal func startVerification() throws -> MockServer {
+        try makeMockServer()
+    }
 
+    /// Verifies the interactions of a verification started with ``startVerification()`` and writes the Pact file.
+    internal func finishVerification(mockServer: MockServer) throws {
         try verifyInternal(mockServer: mockServer)
     }
 
+    /// How long to wait for the mock server to go quiet before ``finishVerification(mockServer:)``, if at all.
+    internal var quiescence: MockServer.Quiescence? {
+        config.quiescence
+    }
+
+    // MARK: - Private
+
+    /// Starts a mock server for the configured interactions or takes one from the configured ``MockServerPool``.
+    private func makeMockServer() throws -> MockServer {
+        guard let pool = config.mockServerPool else {
+            return try MockServer(pact: pact, transferProtocol: .standard)
+        }
+        return try pool.mockServer(for: pact, transferProtocol: .standard)
+    }
+
+    /// Starts a mock server, or takes one from the configured ``MockServerPool``, on the FFI executor.
+    private func makeMockServerAsync() async throws -> MockServer {
+        guard let pool = config.mockServerPool else {
+            return try await MockServer.start(pact: pact, transferProtocol: .standard)
+        }
+        return try await FFIExecutor.run { try pool.mockServer(for: self.pact, transferProtocol: .standard) }
+    }
+
+    private func awaitQuiescenceIfNeeded(_ mockServer: MockServer) async {
+        guard let quiescence = config.quiescence else {
+            return
+        }
+        await mockServer.awaitQuiescence(quiescence)
+    }
+
+    /// Shuts `mockServer` down. Servers taken from a ``MockServerPool`` are never handed out again.
+    private func release(_ mockServer: MockServer) async {
+        await mockServer.shutdown()
+    }
+
     /// Verify the interactions after the consumer client has been invoked
     /// - Parameters:
     ///   - mockServer: The ``MockServer`` instance.
     private func verifyInternal(mockServer: MockServer) throws {
+        let expectedRequests = pendingInteractions.compactMap(\.expectedRequest)
+        pendingInteractions.removeAll()
+
+        guard let registry = pact.registry else {
+            guard mockServer.requestsMatched else {
+                throw Error.pactFailure(try mockServer.verificationFailures(limit: config.failureLimit))
+            }
+
+            try writePactFile(pact)
+            return
+        }
+
+        // The shared Pact also hosts interactions of other builders, so only this builder's are verified.
+        let snapshot = FailureSnapshot(unmatched: pact.interactions)
+        let failures = try attributedFailures(of: mockServer, expectedRequests: expectedRequests, since: snapshot)
+        registry.recordVerification(of: pact, directory: config.outputDirectory, succeeded: failures.isEmpty)
+
+        guard failures.isEmpty else {
+            throw Error.pactFailure(Array(failures.prefix(config.failureLimit ?? failures.count)))
+        }
+    }
+
+    /// Writes `pact` to its file, or hands it to the configured ``PactFileWriter``.
+    private func writePactFile(_ pact: Pact) throws {
+        guard let writer = config.pactFileWriter else {
+            try pact.writePactFile(directory: config.outputDirectory, overwrite: false)
+            return
+        }
+        writer.write(pact, directory: config.outputDirectory)
+    }
+
+    /// Verify the interactions of `testName` on the test's own mock server.
+    ///
+    /// - Parameters:
+    ///   - mockServer: The ``MockServer`` hosting the test's interactions.
+    ///   - testName: The test name the interactions were registered for.
+    private func verifyInternal(mockServer: MockServer, testName: String) throws {
+        verifiedTests.insert(testName)
         guard mockServer.requestsMatched else {
-            let failures = try JSONDecoder().decode([PactVerificationFailure].self, from: mockServer.mismatchesJSON?.data(using: .utf8) ?? Data())
-            throw Error.pactFailure(failures)
+            testVerificationFailed = true
+            throw Error.pactFailure(try mockServer.verificationFailures(limit: config.failureLimit))
+        }
+    }
+
+    /// Missing requests for `expectedRequests`, and failures for requests received since `snapshot` was taken.
+    ///
+    /// The mock server doesn't report which interaction a failure belongs to. A missing request for a method and
+    /// path is only attributed when fewer requests for it were matched since `snapshot` than `expectedRequests`
+    /// expects, so interactions of other tests on the same route don't fail this one. Other failures are
+    /// attributed when they were not already reported in `snapshot`.
+    private func attributedFailures(
+        of mockServer: MockServer,
+        expectedRequests: [(method: Interaction.HTTPMethod, path: String)],
+        since snapshot: FailureSnapshot
+    ) throws -> [PactVerificationFailure] {
+        let failures = try mockServer.verificationFailures()
+
+        var stillMissing: [FailureSnapshot.Route: Int] = [:]
+        for failure in failures where failure.type == .missing {
+            stillMissing[FailureSnapshot.Route(failure), default: 0] += 1
+        }
+
+        var unmatched: [FailureSnapshot.Route: Int] = [:]
+        for request in expectedRequests {
+            unmatched[FailureSnapshot.Route(method: request.method.rawValue, path: request.path), default: 0] += 1
+        }
+        for (route, count) in unmatched {
+            let matched = max(0, snapshot.missing[route, default: 0] - stillMissing[route, default: 0])
+            unmatched[route] = max(0, count - matched)
+        }
+
+        var reported = snapshot.unexpected
+        var attributed: [PactVerificationFailure] = []
+        for failure in failures {
+            if failure.type == .missing {
+                let route = FailureSnapshot.Route(failure)
+                if let count = unmatched[route], count > 0 {
+                    unmatched[route] = count - 1
+                    attributed.append(failure)
+                }
+            } else if let count = reported[failure.description], count > 0 {
+                reported[failure.description] = count - 1
+            } else {
+                attributed.append(failure)
+            }
         }
+        return attributed
+    }
+
+    /// Takes the mock server started up front for `testName`, or starts one.
+    private func takeTestMockServer(for testName: String) throws -> MockServer {
+        if let mockServer = testMockServers.removeValue(forKey: testName) {
+            return mockServer
+        }
+        guard let testPact = testPacts[testName] else {
+            preconditionFailure("No interactions were registered for test '\(testName)'!")
+        }
+        return try MockServer(pact: testPact, transferProtocol: testTransferProtocol)
+    }
+}
+
+// MARK: - Failure snapshot
+
+private extension PactBuilder {
 
-        try pact.writePactFile(directory: config.pactDirectory, overwrite: false)
+    /// The failures a mock server reported at some point, to tell them apart from the failures reported later.
+    struct FailureSnapshot {
+
+        struct Route: Hashable {
+            let method: String
+            let path: String
+
+            init(method: String, path: String) {
+                self.method = method
+                self.path = path
+            }
+
+            init(_ failure: PactVerificationFailure) {
+                self.init(method: failure.method, path: failure.path)
+            }
+        }
+
+        /// The number of missing requests for each route.
+        private(set) var missing: [Route: Int] = [:]
+
+        /// The number of times each other failure was reported, keyed by its description.
+        private(set) var unexpected: [String: Int] = [:]
+
+        /// The failures of a mock server that has not received any request yet for `interactions`.
+        init(unmatched interactions: [Interaction]) {
+            for case let (method, path)? in interactions.map(\.expectedRequest) {
+                missing[Route(method: method.rawValue, path: path), default: 0] += 1
+            }
+        }
     }
 }
 
@@ -0,0 +1,202 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// Writes Pact files in the background, batching the writes to each file.
+///
+/// Writes requested for the same file within ``debounce`` are batched. The Pact core can only merge one Pact
+/// into a file at a time, so each Pact in a batch is still merged into the file on its own. What the batch
+/// saves is the file replacement: the Pacts are merged into a copy of the existing file in a scratch directory
+/// next to the target, which is then renamed over the target once, so a reader never sees a partially written
+/// Pact file.
+///
+/// A write that fails is logged and recorded in ``errors`` until the next ``flush()``, which throws it.
+/// ``PactBuilder/stopMockServer()`` flushes the writer it was configured with. Otherwise callers must flush
+/// the writer themselves to learn about failed writes and to have every pending Pact file written before the
+/// process exits. To write Pact files with the writer, pass it in ``PactBuilder/Config`` and flush it when
+/// the test bundle finishes:
+///
+/// ```swift
+/// let config = PactBuilder.Config(pactDirectory: directory, pactFileWriter: .shared)
+///
+/// func testBundleDidFinish(_ testBundle: Bundle) {
+///     try? PactFileWriter.shared.flush()
+/// }
+/// ```
+///
+public final class PactFileWriter: @unchecked Sendable {
+
+    /// The work the writer has done since it was created.
+    public struct Statistics: Sendable {
+
+        /// The number of times a Pact file was replaced by its merged copy.
+        public var fileWrites = 0
+
+        /// The number of Pacts the Pact core merged into a file. Pacts batched into the same file write are
+        /// still merged one at a time, so this is at least ``fileWrites``.
+        public var merges = 0
+
+        /// The number of write requests, including repeated requests for a Pact that was already pending.
+        public var requests = 0
+
+        /// The number of bytes of the Pact files written, counted once per file write.
+        public var bytesWritten = 0
+
+        /// The time spent by the Pact core merging Pacts into their files, in seconds.
+        public var mergeDuration: TimeInterval = 0
+    }
+
+    /// A writer shared across the test bundle.
+    public static let shared = PactFileWriter()
+
+    /// How long a write is held back for other writes to the same file to be batched with, in seconds.
+    public let debounce: TimeInterval
+
+    private let queue = DispatchQueue(label: "au.com.pact-foundation.PactSwiftMockServer.pact-file-writer", qos: .utility)
+    private let lock = NSLock()
+    private var pending: [String: [Pact]] = [:]
+    private var isScheduled = false
+    private var writeErrors: [Swift.Error] = []
+    private var stats = Statistics()
+
+    /// - Parameters:
+    ///   - debounce: How long a write is held back for other writes to be batched with, in seconds. Defaults to `0.2`.
+    ///
+    public init(debounce: TimeInterval = 0.2) {
+        self.debounce = max(0, debounce)
+    }
+
+    deinit {
+        // Nothing else can reach the writer any more, so the pending files are written here rather than on `queue`.
+        drain()
+    }
+
+    // MARK: - Interface
+
+    /// The work the writer has done so far.
+    public var statistics: Statistics {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return stats
+    }
+
+    /// The errors Pact files failed to be written with since the last ``flush()``.
+    public var errors: [Swift.Error] {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return writeErrors
+    }
+
+    /// Requests `pact` to be merged into its file in `directory`.
+    ///
+    /// The writer holds on to `pact` until it has been written, at the latest ``debounce`` seconds later.
+    /// A failed write is recorded in ``errors`` and thrown by the next ``flush()``.
+    ///
+    /// - Parameters:
+    ///   - pact: The Pact to write.
+    ///   - directory: The directory to write the file to.
+    ///
+    public func write(_ pact: Pact, directory: String) {
+        let path = URL(fileURLWithPath: directory, isDirectory: true).appendingPathComponent(pact.filename).path
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        stats.requests += 1
+        if pending[path, default: []].contains(where: { $0 === pact }) == false {
+            pending[path, default: []].append(pact)
+        }
+
+        guard isScheduled == false else {
+            return
+        }
+        isScheduled = true
+        queue.asyncAfter(deadline: .now() + debounce) { [weak self] in
+            self?.drain()
+        }
+    }
+
+    /// Writes every pending Pact file and waits for the writes to finish.
+    ///
+    /// - Throws: The first error a Pact file failed to be written with since the last flush.
+    ///
+    public func flush() throws {
+        queue.sync { drain() }
+
+        lock.lock()
+        let failures = writeErrors
+        writeErrors.removeAll()
+        lock.unlock()
+
+        if let error = failures.first {
+            throw error
+        }
+    }
+}
+
+// MARK: - Private
+
+private extension PactFileWriter {
+
+    /// Writes every pending Pact file. Must be called on `queue`.
+    func drain() {
+        lock.lock()
+        let files = pending
+        pending.removeAll()
+        isScheduled = false
+        lock.unlock()
+
+        for (path, pacts) in files {
+            do {
+                try write(pacts, to: URL(fileURLWithPath: path))
+            } catch {
+                Logging.log(.error, message: "Failed to write pact file '\(path)': \(error.localizedDescription)")
+                lock.lock()
+                writeErrors.append(error)
+                lock.unlock()
+            }
+        }
+    }
+
+    /// Merges `pacts` one by one into the file at `fileURL` through a scratch directory in the same directory.
+    func write(_ pacts: [Pact], to fileURL: URL) throws {
+        let fileManager = FileManager.default
+        let directory = fileURL.deletingLastPathComponent()
+        let scratchDirectory = directory.appendingPathComponent(".pact-\(UUID().uuidString)", isDirectory: true)
+        let scratchFileURL = scratchDirectory.appendingPathComponent(fileURL.lastPathComponent)
+
+        try fileManager.createDirectory(at: scratchDirectory, withIntermediateDirectories: true)
+        defer { try? fileManager.removeItem(at: scratchDirectory) }
+
+        if fileManager.fileExists(atPath: fileURL.path) {
+            try fileManager.copyItem(at: fileURL, to: scratchFileURL)
+        }
+
+        let start = Date()
+        for pact in pacts {
+            try pact.writePactFile(directory: scratchDirectory.path, overwrite: false)
+        }
+        let mergeDuration = Date().timeIntervalSince(start)
+
+        let bytes = (try fileManager.attributesOfItem(atPath: scratchFileURL.path)[.size] as? NSNumber)?.intValue ?? 0
+        guard rename(scratchFileURL.path, fileURL.path) == 0 else {
+            throw CocoaError(.fileWriteUnknown, userInfo: [NSFilePathErrorKey: fileURL.path])
+        }
+
+        lock.lock()
+        stats.fileWrites += 1
+        stats.merges += pacts.count
+        stats.bytesWritten += bytes
+        stats.mergeDuration += mergeDuration
+        lock.unlock()
+
+        Logging.log(.debug, message: "Wrote \(pacts.count) pact(s), \(bytes) bytes, to '\(fileURL.path)'")
+    }
+}
@@ -0,0 +1,147 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// A process wide registry of ``Pact`` contracts, one per consumer and provider pair.
+///
+/// Every ``PactBuilder`` for the same pair registers its interactions on the same Pact handle. Successful
+/// verifications only mark the Pact as verified; the Pact files are written once, when the test bundle
+/// finishes, instead of being read back and merged on disk after every verification.
+///
+/// ```swift
+/// let pact = try PactRegistry.shared.pact(consumer: "consumer", provider: "provider")
+/// let builder = PactBuilder(pact: pact, config: PactBuilder.Config(pactDirectory: directory))
+/// ```
+///
+/// Write the Pact files from a test observer's `testBundleDidFinish(_:)`:
+///
+/// ```swift
+/// func testBundleDidFinish(_ testBundle: Bundle) {
+///     try? PactRegistry.shared.writePactFiles()
+/// }
+/// ```
+///
+/// The Pact core refuses changes to a Pact once a mock server has been started for it, so every builder for a
+/// pair must get its Pact before the first verification, for example in the test class' `setUp()`. Once a mock
+/// server has started, ``pact(consumer:provider:specification:)`` throws for the pair until ``writePactFiles()``
+/// has written its Pact. The next request then starts a new Pact for the pair.
+///
+/// - Important: Interaction descriptions must be unique across every builder sharing a Pact, and builders
+/// sharing a Pact must not verify concurrently.
+///
+public final class PactRegistry: @unchecked Sendable {
+
+    /// A registry shared across the test bundle.
+    public static let shared = PactRegistry()
+
+    private struct Key: Hashable {
+        let consumer: String
+        let provider: String
+    }
+
+    private struct Entry {
+        let pact: Pact
+        var directories: [String] = []
+        var hasFailed = false
+    }
+
+    private let lock = NSLock()
+    private var entries: [Key: Entry] = [:]
+
+    public init() { }
+
+    // MARK: - Interface
+
+    /// Returns the Pact for `consumer` and `provider`, creating it the first time the pair is requested.
+    ///
+    /// - Throws: ``Pact/Error/canNotBeModified`` if a mock server has already been started for the pair's Pact
+    /// and it hasn't been written by ``writePactFiles()`` yet, or a ``Pact/Error`` if the specification version
+    /// could not be set.
+    ///
+    /// - Parameters:
+    ///   - consumer: The name of the consumer.
+    ///   - provider: The name of the provider.
+    ///   - specification: The Pact specification version, set when the pair's Pact is created. Defaults to `.v4`.
+    ///
+    public func pact(consumer: String, provider: String, specification: Pact.Specification = .v4) throws -> Pact {
+        let key = Key(consumer: consumer, provider: provider)
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let entry = entries[key] {
+            guard entry.pact.hasStartedMockServer == false else {
+                throw Pact.Error.canNotBeModified
+            }
+            return entry.pact
+        }
+
+        let pact = try Pact(consumer: consumer, provider: provider).withSpecification(specification)
+        pact.registry = self
+        entries[key] = Entry(pact: pact)
+        return pact
+    }
+
+    /// Writes the Pact file of every Pact verified since the last write, once per directory.
+    ///
+    /// A Pact with a failed verification is not written. Files are merged with any existing file in the
+    /// directories configured on the ``PactBuilder``s that verified the Pact. Every pair whose Pact started a
+    /// mock server is then forgotten, failed or not, so the next request for it starts a new Pact.
+    ///
+    /// - Throws: The first ``Pact/Error`` a Pact file could not be written with. The remaining files are still written.
+    ///
+    public func writePactFiles() throws {
+        lock.lock()
+        let pending = entries.filter { $0.value.pact.hasStartedMockServer }
+        for key in pending.keys {
+            entries[key] = nil
+        }
+        lock.unlock()
+
+        var firstError: Swift.Error?
+        for entry in pending.values {
+            guard entry.hasFailed == false else {
+                Logging.log(.info, message: "Not writing '\(entry.pact.filename)' as at least one test failed verification")
+                continue
+            }
+            for directory in entry.directories {
+                do {
+                    try entry.pact.writePactFile(directory: directory, overwrite: false)
+                } catch {
+                    Logging.log(.error, message: "Failed to write '\(entry.pact.filename)': \(error.localizedDescription)")
+                    firstError = firstError ?? error
+                }
+            }
+        }
+
+        if let error = firstError {
+            throw error
+        }
+    }
+
+    // MARK: - Internal
+
+    /// Records a verification of `pact`, to be written to `directory` by ``writePactFiles()``.
+    internal func recordVerification(of pact: Pact, directory: String, succeeded: Bool) {
+        let key = Key(consumer: pact.consumer, provider: pact.provider)
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard var entry = entries[key], entry.pact === pact else {
+            return
+        }
+        if entry.directories.contains(directory) == false {
+            entry.directories.append(directory)
+        }
+        if succeeded == false {
+            entry.hasFailed = true
+        }
+        entries[key] = entry
+    }
+}
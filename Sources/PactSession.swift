@@ -0,0 +1,177 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// An actor owning a ``Pact`` and the ``PactBuilder`` verifying it.
+///
+/// ``Pact``, ``Interaction`` and ``PactBuilder`` are not `Sendable`. A session isolates them behind an actor
+/// running on its own serial executor, so any number of tasks can build interactions on many sessions
+/// concurrently, while the work on each session's Pact handle runs one job at a time, in order.
+///
+/// ```swift
+/// let session = try PactSession(consumer: "consumer", provider: "provider", config: config)
+///
+/// try await withThrowingTaskGroup(of: Void.self) { group in
+///     for id in 1...10 {
+///         group.addTask { try await session.addInteraction(template, parameters: ["id": "\(id)"]) }
+///     }
+///     try await group.waitForAll()
+/// }
+///
+/// try await session.verify { context in
+///     // ...
+/// }
+/// ```
+///
+/// - Note: While ``verify(handler:)`` awaits the consumer code other tasks can use the session, but only to read
+/// from it: adding interactions or metadata, and starting another verification, throw until it finishes.
+///
+public actor PactSession {
+
+    /// The name of the consumer.
+    public nonisolated let consumer: String
+
+    /// The name of the provider.
+    public nonisolated let provider: String
+
+    private let executor: FFISerialExecutor
+    private let pact: Pact
+    private let builder: PactBuilder
+    private var isVerifying = false
+
+    /// - Throws: ``Pact/Error`` if the specification version could not be set.
+    ///
+    /// - Parameters:
+    ///   - consumer: The name of the consumer.
+    ///   - provider: The name of the provider.
+    ///   - specification: The Pact specification version. Defaults to `.v4`.
+    ///   - config: The configuration of the ``PactBuilder`` verifying the Pact.
+    ///
+    public init(consumer: String, provider: String, specification: Pact.Specification = .v4, config: PactBuilder.Config) throws {
+        self.consumer = consumer
+        self.provider = provider
+        self.executor = FFISerialExecutor(label: "au.com.pact-foundation.PactSwiftMockServer.session.\(consumer)-\(provider)")
+
+        let pact = try Pact(consumer: consumer, provider: provider).withSpecification(specification)
+        self.pact = pact
+        self.builder = PactBuilder(pact: pact, config: config)
+    }
+
+    public nonisolated var unownedExecutor: UnownedSerialExecutor {
+        executor.asUnownedSerialExecutor()
+    }
+
+    // MARK: - Interface
+
+    /// Adds metadata to the Pact.
+    ///
+    /// - Throws: ``Pact/Error/canNotBeModified`` if Pact can't be modified (i.e. the mock server for it has already started).
+    ///
+    public func withMetadata(namespace: String, name: String, value: String) throws {
+        try checkNotVerifying()
+        _ = try pact.withMetadata(namespace: namespace, name: name, value: value)
+    }
+
+    /// Adds an interaction configured from `spec`.
+    ///
+    /// - Throws: ``Interaction/Error`` if the interaction or Pact can't be modified (i.e. the mock server for it has already started)
+    ///
+    /// - Parameters:
+    ///   - description: The interaction description. It needs to be unique for each interaction.
+    ///   - providerStates: The provider states of the interaction.
+    ///   - spec: The request and response of the interaction.
+    ///
+    public func addInteraction(_ description: String, providerStates: [Interaction.ProviderState] = [], spec: InteractionSpec) throws {
+        try checkNotVerifying()
+        try builder.uponReceiving(description)
+            .given(providerStates)
+            .apply(spec)
+    }
+
+    /// Adds an interaction stamped from `template`.
+    ///
+    /// - Throws: ``Interaction/Error`` if the interaction or Pact can't be modified (i.e. the mock server for it has already started)
+    ///
+    /// - Parameters:
+    ///   - template: The template to stamp.
+    ///   - parameters: The values to replace the template's `{{name}}` placeholders with.
+    ///
+    public func addInteraction(_ template: InteractionTemplate, parameters: [String: String] = [:]) throws {
+        try checkNotVerifying()
+        try builder.uponReceiving(template, parameters: parameters)
+    }
+
+    /// Runs `body` with the session's ``PactBuilder``, for configuration the other methods don't cover.
+    ///
+    /// - Throws: ``Pact/Error/canNotBeModified`` while a verification is in progress, or any error `body` throws.
+    ///
+    /// - Important: `body` must not hold on to the builder, or any ``Interaction`` it creates, after it returns.
+    ///
+    public func withBuilder<T: Sendable>(_ body: @Sendable (PactBuilder) throws -> T) throws -> T {
+        try checkNotVerifying()
+        return try body(builder)
+    }
+
+    /// Verifies the interactions added to the session.
+    ///
+    /// The mock server is started and verified on the session's executor; only `handler` runs elsewhere.
+    ///
+    /// - Throws: A ``PactBuilder/Error/pactFailure(_:)`` if the pact fails to verify, a ``MockServer/Error`` if the
+    /// mock server fails, or ``Pact/Error/canNotBeModified`` if another verification is in progress.
+    ///
+    public func verify(handler: @Sendable (PactBuilder.ConsumerContext) async throws -> Void) async throws {
+        try checkNotVerifying()
+        isVerifying = true
+        defer { isVerifying = false }
+
+        let mockServer = try builder.startVerification()
+        do {
+            try await handler(PactBuilder.ConsumerContext(mockServerURL: mockServer.baseUrl))
+            if let quiescence = builder.quiescence {
+                await mockServer.awaitQuiescence(quiescence)
+            }
+            try builder.finishVerification(mockServer: mockServer)
+        } catch {
+            await mockServer.shutdown()
+            throw error
+        }
+        await mockServer.shutdown()
+    }
+
+    /// Writes the Pact file.
+    ///
+    /// - Throws: ``Pact/Error/canNotWritePact(_:)`` if the Pact file could not be written.
+    ///
+    /// - Parameters:
+    ///   - directory: The directory to write the file to. When `nil` the current working directory is used.
+    ///   - overwrite: When `true` the file is overwritten, otherwise it is merged with any existing file.
+    ///
+    public func writePactFile(directory: String? = nil, overwrite: Bool = false) throws {
+        try checkNotVerifying()
+        try pact.writePactFile(directory: directory, overwrite: overwrite)
+    }
+
+    // MARK: - Internal
+
+    /// `true` when called from a job running on the session's executor.
+    internal nonisolated var isOnExecutor: Bool {
+        executor.isCurrent
+    }
+}
+
+// MARK: - Private
+
+private extension PactSession {
+
+    /// Throws while a verification is in progress, as its mock server owns the Pact until it finishes.
+    func checkNotVerifying() throws {
+        guard isVerifying == false else {
+            throw Pact.Error.canNotBeModified
+        }
+    }
+}
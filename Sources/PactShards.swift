@@ -0,0 +1,193 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// Per-process Pact file shards and the merge step that combines them.
+///
+/// When several test processes write the same Pact file, the Pact core reads, merges and rewrites it from
+/// each of them, and concurrent writers lose each other's updates. With ``PactBuilder/Config/sharded``
+/// enabled each process writes to its own shard directory instead, and a single ``merge(pactDirectory:removeShards:)``
+/// once every process has finished combines the shards into the Pact files.
+///
+/// ```swift
+/// let config = PactBuilder.Config(pactDirectory: directory, sharded: true)
+///
+/// // After all test processes have finished, e.g. from a scheme post-action:
+/// try PactShards.merge(pactDirectory: directory)
+/// ```
+///
+public enum PactShards {
+
+    /// What a merge did.
+    public struct Summary: Sendable {
+
+        /// The number of Pact files written.
+        public let files: Int
+
+        /// The number of shard files merged.
+        public let shards: Int
+
+        /// The number of interactions across the Pact files written.
+        public let interactions: Int
+    }
+
+    /// The identifier of this process' shard.
+    public static let shardID = "\(ProcessInfo.processInfo.processIdentifier)-\(UUID().uuidString)"
+
+    // MARK: - Interface
+
+    /// Merges every shard in `pactDirectory` into the Pact files in `pactDirectory`.
+    ///
+    /// The shards of each Pact file are merged into any existing Pact file. For each description and set of provider
+    /// states the interaction from the shards replaces the one already in the file, so changes made by the latest run
+    /// are kept. Different Pact files are merged in parallel.
+    ///
+    /// - Throws: The first error a Pact file failed to be merged with. The other Pact files are still merged,
+    /// and no shards are removed.
+    ///
+    /// - Parameters:
+    ///   - pactDirectory: The directory the Pact files are written to.
+    ///   - removeShards: Whether to remove the shards once merged. Defaults to `true`.
+    ///
+    /// - Returns: A summary of the merge.
+    ///
+    @discardableResult
+    public static func merge(pactDirectory: String, removeShards: Bool = true) throws -> Summary {
+        let root = shardsRoot(in: pactDirectory)
+        let files = try shardFiles(in: root)
+        let filenames = files.keys.sorted()
+
+        let lock = NSLock()
+        var summary = (files: 0, shards: 0, interactions: 0)
+        var errors: [Swift.Error] = []
+
+        DispatchQueue.concurrentPerform(iterations: filenames.count) { index in
+            let filename = filenames[index]
+            let shards = files[filename] ?? []
+            do {
+                let target = URL(fileURLWithPath: pactDirectory, isDirectory: true).appendingPathComponent(filename)
+                let interactions = try merge(shards, into: target)
+
+                lock.lock()
+                summary.files += 1
+                summary.shards += shards.count
+                summary.interactions += interactions
+                lock.unlock()
+            } catch {
+                Logging.log(.error, message: "Failed to merge shards of '\(filename)': \(error.localizedDescription)")
+                lock.lock()
+                errors.append(error)
+                lock.unlock()
+            }
+        }
+
+        if let error = errors.first {
+            throw error
+        }
+        if removeShards {
+            try? FileManager.default.removeItem(at: root)
+        }
+
+        Logging.log(.info, message: "Merged \(summary.shards) shard(s) into \(summary.files) pact file(s)")
+        return Summary(files: summary.files, shards: summary.shards, interactions: summary.interactions)
+    }
+
+    // MARK: - Internal
+
+    /// The directory this process writes its shard of the Pact files in `pactDirectory` to.
+    internal static func directory(in pactDirectory: String) -> String {
+        shardsRoot(in: pactDirectory).appendingPathComponent(shardID, isDirectory: true).path
+    }
+}
+
+// MARK: - Private
+
+private extension PactShards {
+
+    static let shardsDirectoryName = ".pact-shards"
+
+    /// The collections of interactions in a Pact file; `messages` for V3 message Pacts.
+    static let interactionKeys = ["interactions", "messages"]
+
+    static func shardsRoot(in pactDirectory: String) -> URL {
+        URL(fileURLWithPath: pactDirectory, isDirectory: true).appendingPathComponent(shardsDirectoryName, isDirectory: true)
+    }
+
+    /// The shard files in `root`, grouped by Pact file name.
+    static func shardFiles(in root: URL) throws -> [String: [URL]] {
+        let fileManager = FileManager.default
+        guard fileManager.fileExists(atPath: root.path) else {
+            return [:]
+        }
+
+        var files: [String: [URL]] = [:]
+        for shard in try fileManager.contentsOfDirectory(at: root, includingPropertiesForKeys: nil).sorted(by: { $0.path < $1.path }) {
+            for file in try fileManager.contentsOfDirectory(at: shard, includingPropertiesForKeys: nil) where file.pathExtension == "json" {
+                files[file.lastPathComponent, default: []].append(file)
+            }
+        }
+        return files
+    }
+
+    /// Merges `shards` into the Pact file at `target`, returning the number of interactions written.
+    ///
+    /// Sources are merged in order, the existing file first; an interaction replaces an earlier one with the same
+    /// identity in place.
+    ///
+    /// `JSONSerialization` doesn't keep the order of an object's keys, so the merged file is written with its keys
+    /// sorted. The key order the Pact core wrote is not preserved; it only matches where the core sorted them too.
+    static func merge(_ shards: [URL], into target: URL) throws -> Int {
+        let sources = (FileManager.default.fileExists(atPath: target.path) ? [target] : []) + shards
+        var merged: [String: Any]?
+        var positions: [String: [String: Int]] = [:]
+
+        for source in sources {
+            guard let pact = try JSONSerialization.jsonObject(with: Data(contentsOf: source)) as? [String: Any] else {
+                throw CocoaError(.fileReadCorruptFile, userInfo: [NSFilePathErrorKey: source.path])
+            }
+
+            var document = merged ?? pact
+            for key in interactionKeys {
+                var interactions = merged == nil ? [] : (document[key] as? [Any] ?? [])
+                for interaction in pact[key] as? [[String: Any]] ?? [] {
+                    let identity = try identity(of: interaction)
+                    if let position = positions[key]?[identity] {
+                        interactions[position] = interaction
+                    } else {
+                        positions[key, default: [:]][identity] = interactions.count
+                        interactions.append(interaction)
+                    }
+                }
+                if interactions.isEmpty == false || document[key] != nil {
+                    document[key] = interactions
+                }
+            }
+            merged = document
+        }
+
+        guard let merged = merged else {
+            return 0
+        }
+
+        let data = try JSONSerialization.data(withJSONObject: merged, options: [.prettyPrinted, .sortedKeys, .withoutEscapingSlashes])
+        try data.write(to: target, options: .atomic)
+
+        return interactionKeys.reduce(0) { $0 + ((merged[$1] as? [Any])?.count ?? 0) }
+    }
+
+    /// Identifies an interaction by its V4 type, description and provider states, as the Pact core does when merging.
+    ///
+    /// Interactions of V3 and older Pacts have no type, so only their description and provider states identify them.
+    static func identity(of interaction: [String: Any]) throws -> String {
+        let type = interaction["type"] as? String ?? ""
+        let description = interaction["description"] as? String ?? ""
+        let states = interaction["providerStates"] ?? interaction["providerState"] ?? NSNull()
+        let statesData = try JSONSerialization.data(withJSONObject: [states], options: .sortedKeys)
+        return type + "\u{0}" + description + "\u{0}" + String(decoding: statesData, as: UTF8.self)
+    }
+}
@@ -0,0 +1,189 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// Verifies many ``PactBuilder`` jobs concurrently.
+///
+/// Each job runs its own ``PactBuilder/verify(handler:)`` in a child task. At most
+/// ``maxConcurrency`` jobs run at once, which by default is bound by both the number of active
+/// processors and the number of file descriptors the process may open.
+///
+/// ```swift
+/// let runner = PactSuiteRunner()
+/// let outcome = await runner.run([
+///     PactSuiteRunner.Job(builder: eventsBuilder) { context in try await eventsClient(context).fetch() },
+///     PactSuiteRunner.Job(builder: usersBuilder) { context in try await usersClient(context).fetch() },
+/// ])
+/// XCTAssertTrue(outcome.succeeded, outcome.description)
+/// ```
+///
+public final class PactSuiteRunner {
+
+    /// A single Pact verification.
+    ///
+    /// - Important: A job's ``PactBuilder`` must not be shared with another job or verified elsewhere while the runner is running.
+    public struct Job: @unchecked Sendable {
+
+        /// The name the job is reported under.
+        public let name: String
+
+        let builder: PactBuilder
+        let handler: @Sendable (PactBuilder.ConsumerContext) async throws -> Void
+
+        /// - Parameters:
+        ///   - name: The name the job is reported under. Defaults to the Pact's file name.
+        ///   - builder: The ``PactBuilder`` with its interactions already configured.
+        ///   - handler: The consumer code to run against the mock server.
+        public init(
+            name: String? = nil,
+            builder: PactBuilder,
+            handler: @escaping @Sendable (PactBuilder.ConsumerContext) async throws -> Void
+        ) {
+            self.name = name ?? builder.pactFilename
+            self.builder = builder
+            self.handler = handler
+        }
+    }
+
+    /// The aggregated outcome of a run.
+    public struct Outcome: Sendable {
+
+        /// The outcome of a single job.
+        public struct Entry: Sendable {
+
+            /// The name of the job.
+            public let name: String
+
+            /// The wall time the job took to verify, in seconds.
+            public let duration: TimeInterval
+
+            /// The error the job failed with, or `nil` if it verified successfully.
+            public let error: Error?
+        }
+
+        /// The outcome of every job, in the order the jobs were provided.
+        public let entries: [Entry]
+
+        /// The wall time of the whole run, in seconds.
+        public let duration: TimeInterval
+
+        /// `true` when every job verified successfully.
+        public var succeeded: Bool {
+            entries.allSatisfy { $0.error == nil }
+        }
+
+        /// The jobs that failed to verify.
+        public var failures: [Entry] {
+            entries.filter { $0.error != nil }
+        }
+    }
+
+    /// The maximum number of jobs verified at the same time.
+    public let maxConcurrency: Int
+
+    /// - Parameters:
+    ///   - maxConcurrency: The maximum number of jobs verified at the same time.
+    ///   Defaults to ``PactSuiteRunner/defaultMaxConcurrency``.
+    public init(maxConcurrency: Int? = nil) {
+        self.maxConcurrency = max(1, maxConcurrency ?? Self.defaultMaxConcurrency)
+    }
+
+    // MARK: - Interface
+
+    /// The default concurrency limit: the number of active processors, reduced when the process' open file
+    /// descriptor limit can't accommodate that many mock servers and their client connections.
+    public static var defaultMaxConcurrency: Int {
+        let processors = ProcessInfo.processInfo.activeProcessorCount
+        guard let descriptorLimit = openFileDescriptorLimit else {
+            return max(1, processors)
+        }
+        return max(1, min(processors, descriptorLimit / descriptorsPerJob))
+    }
+
+    /// Verifies `jobs` concurrently, running at most ``maxConcurrency`` at a time.
+    ///
+    /// - Parameters:
+    ///   - jobs: The jobs to verify.
+    ///
+    /// - Returns: The aggregated outcome with an entry for every job.
+    ///
+    public func run(_ jobs: [Job]) async -> Outcome {
+        let start = Date()
+        var entries = [Outcome.Entry?](repeating: nil, count: jobs.count)
+
+        await withTaskGroup(of: (Int, Outcome.Entry).self) { group in
+            var pending = jobs.enumerated().makeIterator()
+
+            for _ in 0..<min(maxConcurrency, jobs.count) {
+                if case let (index, job)? = pending.next() {
+                    group.addTask { (index, await Self.verify(job)) }
+                }
+            }
+
+            for await (index, entry) in group {
+                entries[index] = entry
+                if case let (index, job)? = pending.next() {
+                    group.addTask { (index, await Self.verify(job)) }
+                }
+            }
+        }
+
+        let outcome = Outcome(entries: entries.compactMap { $0 }, duration: Date().timeIntervalSince(start))
+        Logging.log(
+            outcome.succeeded ? .info : .error,
+            message: "Verified \(jobs.count) pact(s) in \(String(format: "%.3f", outcome.duration))s, \(outcome.failures.count) failed"
+        )
+        return outcome
+    }
+}
+
+// MARK: - Extensions
+
+extension PactSuiteRunner.Outcome: CustomStringConvertible {
+
+    public var description: String {
+        entries
+            .map { entry in
+                let outcome = entry.error.map { "FAILED: \($0.localizedDescription)" } ?? "OK"
+                return "\(entry.name) (\(String(format: "%.3f", entry.duration))s) \(outcome)"
+            }
+            .joined(separator: "\n")
+    }
+}
+
+// MARK: - Private
+
+private extension PactSuiteRunner {
+
+    /// A conservative estimate of the descriptors a verification holds: the mock server's listener, the
+    /// client's and server's side of each connection, and the Pact file.
+    static let descriptorsPerJob = 16
+
+    static var openFileDescriptorLimit: Int? {
+        var limit = rlimit()
+        #if os(Linux)
+        let resource = __rlimit_resource_t(RLIMIT_NOFILE.rawValue)
+        #else
+        let resource = RLIMIT_NOFILE
+        #endif
+        guard getrlimit(resource, &limit) == 0 else {
+            return nil
+        }
+        return limit.rlim_cur == RLIM_INFINITY ? nil : Int(clamping: limit.rlim_cur)
+    }
+
+    static func verify(_ job: Job) async -> Outcome.Entry {
+        let start = Date()
+        do {
+            try await job.builder.verify(handler: job.handler)
+            return Outcome.Entry(name: job.name, duration: Date().timeIntervalSince(start), error: nil)
+        } catch {
+            return Outcome.Entry(name: job.name, duration: Date().timeIntervalSince(start), error: error)
+        }
+    }
+}
@@ -0,0 +1,253 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+#if SWIFT_PACKAGE
+import PactMockServer
+#endif
+
+/// Collects the log entries of Pact plugin instances in the background.
+///
+/// The entries of each watched plugin instance are read from the Pact core and queued in a fixed size ring
+/// buffer. A separate queue drains the buffer and hands the records to `handler`, so a slow handler never holds
+/// up reading the logs. When the handler falls behind and the buffer fills up, new records are dropped and
+/// counted in ``statistics``.
+///
+/// ```swift
+/// let collector = PluginLogCollector { records in
+///     records.forEach { print($0.pluginInstanceID, $0.json) }
+/// }
+/// collector.watch(pluginInstanceID: instanceID)
+/// collector.start()
+/// ```
+///
+public final class PluginLogCollector: @unchecked Sendable {
+
+    /// A plugin log entry.
+    public struct Record: Sendable, Equatable {
+
+        /// The plugin instance that logged the entry.
+        public let pluginInstanceID: String
+
+        /// The entry, as the JSON object the Pact core recorded it as.
+        public let json: String
+    }
+
+    /// The records the collector has handled so far.
+    public struct Statistics: Sendable, Equatable {
+
+        /// The number of records read from watched plugin instances.
+        public let received: Int
+
+        /// The number of records handed to the handler.
+        public let delivered: Int
+
+        /// The number of records dropped because the ring buffer was full.
+        public let dropped: Int
+
+        /// The number of records ignored because their plugin instance isn't watched.
+        public let filtered: Int
+    }
+
+    /// How often the logs of the watched plugin instances are read, in seconds.
+    public let pollInterval: TimeInterval
+
+    private let ring: RingBuffer<Record>
+    private let handler: @Sendable ([Record]) -> Void
+    private let pollQueue = DispatchQueue(label: "au.com.pact-foundation.PactSwiftMockServer.plugin-logs.poll", qos: .utility)
+    private let deliveryQueue = DispatchQueue(label: "au.com.pact-foundation.PactSwiftMockServer.plugin-logs.delivery", qos: .utility)
+
+    private let lock = NSLock()
+    /// The number of bytes of each watched plugin instance's log already read.
+    private var readOffsets: [String: Int] = [:]
+    private var receivedCount = 0
+    private var deliveredCount = 0
+    private var filteredCount = 0
+    private var timer: DispatchSourceTimer?
+
+    /// - Parameters:
+    ///   - capacity: The number of records the ring buffer holds. Defaults to `1_024`.
+    ///   - pollInterval: How often the logs are read, in seconds. Defaults to `0.1`.
+    ///   - handler: Called on a background queue with the records read since it was last called, oldest first.
+    ///
+    public init(capacity: Int = 1_024, pollInterval: TimeInterval = 0.1, handler: @escaping @Sendable ([Record]) -> Void) {
+        self.ring = RingBuffer(capacity: capacity)
+        self.pollInterval = pollInterval
+        self.handler = handler
+    }
+
+    deinit {
+        timer?.cancel()
+    }
+
+    // MARK: - Interface
+
+    /// The plugin instances whose logs are collected.
+    public var watchedPluginInstanceIDs: Set<String> {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return Set(readOffsets.keys)
+    }
+
+    /// The records the collector has handled so far.
+    public var statistics: Statistics {
+        let dropped = ring.dropped
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        return Statistics(received: receivedCount, delivered: deliveredCount, dropped: dropped, filtered: filteredCount)
+    }
+
+    /// Starts collecting the logs of the plugin instance with `pluginInstanceID`, from its first entry.
+    public func watch(pluginInstanceID: String) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if readOffsets[pluginInstanceID] == nil {
+            readOffsets[pluginInstanceID] = 0
+        }
+    }
+
+    /// Stops collecting the logs of the plugin instance with `pluginInstanceID`.
+    public func unwatch(pluginInstanceID: String) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        readOffsets[pluginInstanceID] = nil
+    }
+
+    /// Starts reading the logs every ``pollInterval`` seconds.
+    public func start() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard timer == nil else {
+            return
+        }
+
+        let timer = DispatchSource.makeTimerSource(queue: pollQueue)
+        timer.schedule(deadline: .now(), repeating: pollInterval)
+        timer.setEventHandler { [weak self] in
+            self?.poll()
+        }
+        timer.resume()
+        self.timer = timer
+    }
+
+    /// Stops reading the logs and delivers the records already read.
+    public func stop() {
+        lock.lock()
+        let timer = self.timer
+        self.timer = nil
+        lock.unlock()
+
+        timer?.cancel()
+        pollQueue.sync { }
+        deliveryQueue.sync { deliver() }
+    }
+
+    /// Reads the logs now and waits until every record read has been handed to the handler.
+    public func flush() {
+        pollQueue.sync { poll() }
+        deliveryQueue.sync { deliver() }
+    }
+
+    // MARK: - Internal
+
+    /// The entries in the bytes of `log` past `offset`, one JSON object per line.
+    ///
+    /// Only those bytes are copied; the entries before `offset` were read by an earlier poll.
+    internal static func entries(in log: UnsafeBufferPointer<UInt8>, after offset: Int) -> [Substring] {
+        guard log.count > offset else {
+            return []
+        }
+        return String(decoding: UnsafeBufferPointer(rebasing: log[offset...]), as: UTF8.self).split(separator: "\n")
+    }
+
+    /// Queues the entries in `lines` logged by `pluginInstanceID`, ignoring them if the instance isn't watched.
+    internal func ingest<Lines: Sequence>(_ lines: Lines, pluginInstanceID: String) where Lines.Element: StringProtocol {
+        let records = lines.map { Record(pluginInstanceID: pluginInstanceID, json: String($0)) }
+
+        lock.lock()
+        guard readOffsets[pluginInstanceID] != nil else {
+            filteredCount += records.count
+            lock.unlock()
+            return
+        }
+        receivedCount += records.count
+        lock.unlock()
+
+        for record in records {
+            ring.push(record)
+        }
+        deliveryQueue.async { [weak self] in
+            self?.deliver()
+        }
+    }
+}
+
+// MARK: - Private
+
+private extension PluginLogCollector {
+
+    /// Reads the entries logged by every watched plugin instance since the previous poll. Must be called on `pollQueue`.
+    func poll() {
+        lock.lock()
+        let instances = readOffsets
+        lock.unlock()
+
+        for (pluginInstanceID, readOffset) in instances {
+            guard let read = Self.logs(of: pluginInstanceID, after: readOffset), read.length != readOffset else {
+                continue
+            }
+
+            lock.lock()
+            if readOffsets[pluginInstanceID] != nil {
+                readOffsets[pluginInstanceID] = read.length
+            }
+            lock.unlock()
+
+            if read.lines.isEmpty == false {
+                ingest(read.lines, pluginInstanceID: pluginInstanceID)
+            }
+        }
+    }
+
+    /// Hands the queued records to the handler. Must be called on `deliveryQueue`.
+    func deliver() {
+        let records = ring.drain()
+        guard records.isEmpty == false else {
+            return
+        }
+
+        handler(records)
+
+        lock.lock()
+        deliveredCount += records.count
+        lock.unlock()
+    }
+
+    /// The entries the Pact core has buffered for `pluginInstanceID` past the first `offset` bytes, and the length of
+    /// the buffered log in bytes, or `nil` if the Pact core has no log for the instance.
+    ///
+    /// The Pact core returns the whole log on every call, but only the bytes past `offset` are copied out of it.
+    /// A log shorter than `offset` yields no entries, and its length is read from next time.
+    static func logs(of pluginInstanceID: String, after offset: Int) -> (lines: [Substring], length: Int)? {
+        pluginInstanceID.withUTF8CString { pluginInstanceID in
+            guard let logs = pactffi_get_plugin_logs(pluginInstanceID) else {
+                return nil
+            }
+            defer { pactffi_string_delete(UnsafeMutablePointer(mutating: logs)) }
+
+            let log = UnsafeBufferPointer(start: UnsafeRawPointer(logs).assumingMemoryBound(to: UInt8.self), count: strlen(logs))
+            return (entries(in: log, after: offset), log.count)
+        }
+    }
+}
@@ -37,4 +37,63 @@ public protocol BodyBuilder {
     ///
     @discardableResult
     func body(_ body: Data, contentType: String) throws -> Self
+
+    /// Adds a JSON body with embedded matching rules for the ``Interaction``
+    ///
+    /// - Throws: ``Interaction/Error/canNotBeModified`` if the interaction or Pact can't be modified
+    /// (i.e. the mock server for it has already started) or an error has occurred.
+    ///
+    /// - Parameters:
+    ///   - body: The serialised body.
+    ///   - contentType: The content type of the body.
+    ///
+    @discardableResult
+    func body(_ body: MatchingBody, contentType: String) throws -> Self
+
+    /// Adds the contents of a file as the binary body for the ``Interaction``
+    ///
+    /// How the body is matched depends on the conforming type. The request and response builders of an
+    /// ``Interaction`` match it on its content type only. Conforming types relying on the default implementation
+    /// match it on its contents, as it is added through the binary `body(_:contentType:)`.
+    ///
+    /// - Throws: An error if the file can't be read, or ``Interaction/Error/canNotBeModified`` if the interaction
+    /// or Pact can't be modified (i.e. the mock server for it has already started) or an error has occurred.
+    ///
+    /// - Parameters:
+    ///   - fileURL: The URL of the file with the example body content.
+    ///   - contentType: The content type of the body.
+    ///
+    @discardableResult
+    func body(fileURL: URL, contentType: String) throws -> Self
+}
+
+// MARK: - Default implementations
+
+public extension BodyBuilder {
+
+    /// Adds a JSON body with embedded matching rules for the ``Interaction``
+    ///
+    /// The default implementation passes the body's IntegrationJson to the string `body(_:contentType:)`.
+    ///
+    /// - Throws: ``Interaction/Error/canNotBeModified`` if the interaction or Pact can't be modified
+    /// (i.e. the mock server for it has already started) or an error has occurred.
+    ///
+    @discardableResult
+    func body(_ body: MatchingBody, contentType: String) throws -> Self {
+        try self.body(body.json, contentType: contentType)
+    }
+
+    /// Adds the contents of a file as the binary body for the ``Interaction``
+    ///
+    /// The default implementation passes the memory-mapped contents to the binary `body(_:contentType:)`, so unlike
+    /// the request and response builders of an ``Interaction`` the body is matched on its contents, not only its
+    /// content type.
+    ///
+    /// - Throws: An error if the file can't be read, or ``Interaction/Error/canNotBeModified`` if the interaction
+    /// or Pact can't be modified (i.e. the mock server for it has already started) or an error has occurred.
+    ///
+    @discardableResult
+    func body(fileURL: URL, contentType: String) throws -> Self {
+        try body(Data(contentsOf: fileURL, options: .alwaysMapped), contentType: contentType)
+    }
 }
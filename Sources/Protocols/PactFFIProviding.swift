@@ -28,16 +28,18 @@ protocol PactFFIProviding {
 
     func mockServerMismatches(port: Int32) -> String?
 
+    /// The UTF-8 mismatches JSON, without the terminating null character. The buffer is owned by the mock server
+    /// and stays valid until ``mockServerCleanup(port:)`` is called for `port`.
+    func mockServerMismatchesBuffer(port: Int32) -> UnsafeBufferPointer<UInt8>?
+
     func mockServerLogs(port: Int32) -> String?
 
+    func mockServerLogsLength(port: Int32) -> Int?
+
     func mockServerCleanup(port: Int32) -> Bool
 
     func tlsCACertificate() -> String?
 
-    // Method interface
-
-    func stringRelease(cert: String)
-
     // Pact
 
     func newPact(consumer: String, provider: String) -> PactHandle
@@ -70,6 +72,19 @@ protocol PactFFIProviding {
 
     func withBody(handle: InteractionHandle, body: Data, contentType: String, interactionPart: InteractionPart) throws
 
+    func withBody(handle: InteractionHandle, body: MatchingBody, contentType: String, interactionPart: InteractionPart) throws
+
+    func withBinaryFile(handle: InteractionHandle, body: Data, contentType: String, interactionPart: InteractionPart) throws
+
+    func withMultipartFile(
+        handle: InteractionHandle,
+        path: String,
+        partName: String,
+        contentType: String,
+        boundary: String?,
+        interactionPart: InteractionPart
+    ) throws
+
     func withStatus(handle: InteractionHandle, status: Int) throws
 
     func given(handle: InteractionHandle, description: String) throws
@@ -78,6 +93,8 @@ protocol PactFFIProviding {
 
     func withRequest(handle: InteractionHandle, method: Interaction.HTTPMethod, path: String) throws
 
+    func apply(_ spec: CompiledInteractionSpec, handle: InteractionHandle) throws
+
     // Utils
 
     func generateString(regex: String) -> String?
@@ -29,13 +29,9 @@ struct DefaultPactFFIProvider: PactFFIProviding {
         port: Int32,
         transferProtocol: MockServer.TransferProtocol
     ) throws -> Int32 {
-        let result = pactffi_create_mock_server_for_transport(
-            pactHandle,
-            socketAddress,
-            UInt16(port),
-            transferProtocol.protocol,
-            nil
-        )
+        let result = withUTF8CStrings(socketAddress, transferProtocol.protocol) { socketAddress, transport in
+            pactffi_create_mock_server_for_transport(pactHandle, socketAddress, UInt16(port), transport, nil)
+        }
         if result <= 0 {
             throw MockServer.Error(rawValue: result)
         }
@@ -51,14 +47,11 @@ struct DefaultPactFFIProvider: PactFFIProviding {
         guard let cString = pactffi_get_tls_ca_certificate() else {
             return nil
         }
+        defer { pactffi_string_delete(cString) }
 
         return String(cString: cString)
     }
 
-    func stringRelease(cert: String) {
-        pactffi_string_delete(strdup(cert))
-    }
-
     func mockServerMatched(port: Int32) -> Bool {
         pactffi_mock_server_matched(port)
     }
@@ -68,13 +61,29 @@ struct DefaultPactFFIProvider: PactFFIProviding {
         return String(cString: cString)
     }
 
+    func mockServerMismatchesBuffer(port: Int32) -> UnsafeBufferPointer<UInt8>? {
+        guard let cString = pactffi_mock_server_mismatches(port) else {
+            return nil
+        }
+
+        let length = strlen(cString)
+        return UnsafeBufferPointer(start: UnsafeRawPointer(cString).assumingMemoryBound(to: UInt8.self), count: length)
+    }
+
     func mockServerLogs(port: Int32) -> String? {
         guard let cString = pactffi_mock_server_logs(port) else { return nil }
         return String(cString: cString)
     }
 
+    func mockServerLogsLength(port: Int32) -> Int? {
+        guard let cString = pactffi_mock_server_logs(port) else { return nil }
+        return strlen(cString)
+    }
+
     func newPact(consumer: String, provider: String) -> PactHandle {
-        pactffi_new_pact(consumer.cString(using: .utf8), provider.cString(using: .utf8))
+        withUTF8CStrings(consumer, provider) { consumer, provider in
+            pactffi_new_pact(consumer, provider)
+        }
     }
 
     func freePactHandle(_ handle: PactHandle) -> UInt32 {
@@ -100,22 +109,18 @@ struct DefaultPactFFIProvider: PactFFIProviding {
     }
 
     func withMetadata(handle: PactHandle, namespace: String, key: String, value: String) throws {
-        guard pactffi_with_pact_metadata(
-            handle,
-            namespace.cString(using: .utf8),
-            key.cString(using: .utf8),
-            value.cString(using: .utf8)
-        ) else {
+        let isApplied = withUTF8CStrings(namespace, key, value) { namespace, key, value in
+            pactffi_with_pact_metadata(handle, namespace, key, value)
+        }
+        guard isApplied else {
             throw Pact.Error.canNotBeModified
         }
     }
 
     func writePactFile(handle: PactHandle, to writeDirectory: String, overwrite: Bool) throws -> Int {
-        let result = pactffi_pact_handle_write_file(
-            handle,
-            writeDirectory.cString(using: .utf8),
-            overwrite
-        )
+        let result = writeDirectory.withUTF8CString { writeDirectory in
+            pactffi_pact_handle_write_file(handle, writeDirectory, overwrite)
+        }
         guard result == 0 else {
             throw Pact.Error.canNotWritePact(result)
         }
@@ -125,7 +130,9 @@ struct DefaultPactFFIProvider: PactFFIProviding {
     // API Interaction
 
     func newInteraction(handle: PactHandle, description: String) -> InteractionHandle {
-        pactffi_new_interaction(handle, description.cString(using: .utf8))
+        description.withUTF8CString { description in
+            pactffi_new_interaction(handle, description)
+        }
     }
 
     func withQueryParameter(handle: InteractionHandle, name: String, values: [String]) throws {
@@ -134,37 +141,32 @@ struct DefaultPactFFIProvider: PactFFIProviding {
             return
         }
 
-        try values.enumerated().forEach { offset, value in
-            guard pactffi_with_query_parameter_v2(
-                handle,
-                name.cString(using: .utf8),
-                offset,
-                value.cString(using: .utf8)
-            ) else {
-                throw Interaction.Error.canNotBeModified
+        try name.withUTF8CString { name in
+            for (offset, value) in values.enumerated() {
+                let isApplied = value.withUTF8CString { value in
+                    pactffi_with_query_parameter_v2(handle, name, offset, value)
+                }
+                guard isApplied else {
+                    throw Interaction.Error.canNotBeModified
+                }
             }
         }
     }
 
     func withQueryParameterWithoutAssociatedValue(handle: InteractionHandle, name: String) throws {
-        guard pactffi_with_query_parameter_v2(
-            handle,
-            name.cString(using: .utf8),
-            0,
-            nil
-        ) else {
+        let isApplied = name.withUTF8CString { name in
+            pactffi_with_query_parameter_v2(handle, name, 0, nil)
+        }
+        guard isApplied else {
             throw Interaction.Error.canNotBeModified
         }
     }
 
     func withHeader(handle: InteractionHandle, name: String, value: String, interactionPart: InteractionPart) throws {
-        guard pactffi_with_header_v2(
-            handle,
-            interactionPart,
-            name.cString(using: .utf8),
-            0,
-            value.cString(using: .utf8)
-        ) else {
+        let isApplied = withUTF8CStrings(name, value) { name, value in
+            pactffi_with_header_v2(handle, interactionPart, name, 0, value)
+        }
+        guard isApplied else {
             throw Interaction.Error.canNotBeModified
         }
     }
@@ -175,43 +177,90 @@ struct DefaultPactFFIProvider: PactFFIProviding {
             return
         }
 
-        try values.enumerated().forEach { offset, value in
-            guard pactffi_with_header_v2(
-                handle,
-                interactionPart,
-                name.cString(using: .utf8),
-                offset,
-                value.cString(using: .utf8)
-            ) else {
-                throw Interaction.Error.canNotBeModified
+        try name.withUTF8CString { name in
+            for (offset, value) in values.enumerated() {
+                let isApplied = value.withUTF8CString { value in
+                    pactffi_with_header_v2(handle, interactionPart, name, offset, value)
+                }
+                guard isApplied else {
+                    throw Interaction.Error.canNotBeModified
+                }
             }
         }
     }
 
     func withBody(handle: InteractionHandle, body: String?, contentType: String, interactionPart: InteractionPart) throws {
-        guard pactffi_with_body(
-            handle,
-            interactionPart,
-            contentType.cString(using: .utf8),
-            body?.cString(using: .utf8)
-        ) else {
+        let isApplied = contentType.withUTF8CString { contentType in
+            body.withUTF8CString { body in
+                pactffi_with_body(handle, interactionPart, contentType, body)
+            }
+        }
+        guard isApplied else {
             throw Interaction.Error.canNotBeModified
         }
     }
 
     func withBody(handle: InteractionHandle, body: Data, contentType: String, interactionPart: InteractionPart) throws {
-        let byteArray: [UInt8] = Array(body)
-        guard pactffi_with_binary_body(
-            handle,
-            interactionPart,
-            contentType.cString(using: .utf8),
-            byteArray,
-            byteArray.count
-        ) else {
+        let isApplied = contentType.withUTF8CString { contentType in
+            body.withUnsafeBytes { bytes in
+                pactffi_with_binary_body(handle, interactionPart, contentType, bytes.bindMemory(to: UInt8.self).baseAddress, bytes.count)
+            }
+        }
+        guard isApplied else {
+            throw Interaction.Error.canNotBeModified
+        }
+    }
+
+    func withBody(handle: InteractionHandle, body: MatchingBody, contentType: String, interactionPart: InteractionPart) throws {
+        let isApplied = contentType.withUTF8CString { contentType in
+            body.withCString { body in
+                pactffi_with_body(handle, interactionPart, contentType, body)
+            }
+        }
+        guard isApplied else {
+            throw Interaction.Error.canNotBeModified
+        }
+    }
+
+    func withBinaryFile(handle: InteractionHandle, body: Data, contentType: String, interactionPart: InteractionPart) throws {
+        let isApplied = contentType.withUTF8CString { contentType in
+            body.withUnsafeBytes { bytes in
+                pactffi_with_binary_file(handle, interactionPart, contentType, bytes.bindMemory(to: UInt8.self).baseAddress, bytes.count)
+            }
+        }
+        guard isApplied else {
             throw Interaction.Error.canNotBeModified
         }
     }
 
+    func withMultipartFile(
+        handle: InteractionHandle,
+        path: String,
+        partName: String,
+        contentType: String,
+        boundary: String?,
+        interactionPart: InteractionPart
+    ) throws {
+        let result = withUTF8CStrings(contentType, path, partName) { contentType, path, partName in
+            boundary.withUTF8CString { boundary in
+                pactffi_with_multipart_file_v2(handle, interactionPart, contentType, path, partName, boundary)
+            }
+        }
+
+        switch result.tag {
+        case StringResult_Ok:
+            if let message = result.ok {
+                pactffi_string_delete(message)
+            }
+        default:
+            let message = result.failed.map { String(cString: $0) }
+            if let failed = result.failed {
+                pactffi_string_delete(failed)
+            }
+            throw InteractionError.multipartFileFailed(message)
+        }
+    }
+
     func withStatus(handle: InteractionHandle, status: Int) throws {
         guard pactffi_response_status(handle, UInt16(status)) else {
             throw Interaction.Error.canNotBeModified
@@ -219,13 +268,18 @@ struct DefaultPactFFIProvider: PactFFIProviding {
     }
 
     func given(handle: InteractionHandle, description: String) throws {
-        guard pactffi_given(handle, description.cString(using: .utf8)) else {
+        let isApplied = description.withUTF8CString { description in
+            pactffi_given(handle, description)
+        }
+        guard isApplied else {
             throw Interaction.Error.canNotBeModified
         }
     }
 
     func interactionTestName(handle: InteractionHandle, name: String) throws {
-        let result = pactffi_interaction_test_name(handle, name.cString(using: .utf8))
+        let result = name.withUTF8CString { name in
+            pactffi_interaction_test_name(handle, name)
+        }
 
         guard result == 0 else {
             switch result {
@@ -244,24 +298,48 @@ struct DefaultPactFFIProvider: PactFFIProviding {
     }
 
     func given(handle: InteractionHandle, description: String, name: String, value: String) throws {
-        guard pactffi_given_with_param(
-            handle,
-            description.cString(using: .utf8),
-            name.cString(using: .utf8),
-            value.cString(using: .utf8)
-        ) else {
+        let isApplied = withUTF8CStrings(description, name, value) { description, name, value in
+            pactffi_given_with_param(handle, description, name, value)
+        }
+        guard isApplied else {
             throw InteractionError.canNotBeModified
         }
     }
 
     func withRequest(handle: InteractionHandle, method: Interaction.HTTPMethod, path: String) throws {
-        guard pactffi_with_request(handle, method.rawValue.cString(using: .utf8), path.cString(using: .utf8)) else {
+        let isApplied = withUTF8CStrings(method.rawValue, path) { method, path in
+            pactffi_with_request(handle, method, path)
+        }
+        guard isApplied else {
             throw InteractionError.canNotBeModified
         }
     }
 
+    func apply(_ spec: CompiledInteractionSpec, handle: InteractionHandle) throws {
+        try spec.arena.withCStrings { strings in
+            guard pactffi_with_request(handle, strings[spec.method], strings[spec.path]) else {
+                throw InteractionError.canNotBeModified
+            }
+            for parameter in spec.query {
+                guard pactffi_with_query_parameter_v2(handle, strings[parameter.name], 0, parameter.value.map { strings[$0] }) else {
+                    throw InteractionError.canNotBeModified
+                }
+            }
+            try applyHeaders(spec.requestHeaders, handle: handle, interactionPart: .request, strings: strings)
+            try applyBody(spec.requestBody, handle: handle, interactionPart: .request, strings: strings)
+
+            guard pactffi_response_status(handle, spec.status) else {
+                throw InteractionError.canNotBeModified
+            }
+            try applyHeaders(spec.responseHeaders, handle: handle, interactionPart: .response, strings: strings)
+            try applyBody(spec.responseBody, handle: handle, interactionPart: .response, strings: strings)
+        }
+    }
+
     func generateString(regex: String) -> String? {
-        let result = pactffi_generate_regex_value(regex.cString(using: .utf8))
+        let result = regex.withUTF8CString { regex in
+            pactffi_generate_regex_value(regex)
+        }
         guard
             result.tag == StringResult_Ok,
             let stringPointer = result.ok
@@ -277,7 +355,9 @@ struct DefaultPactFFIProvider: PactFFIProviding {
     }
 
     func generateDateTimeString(format: String) -> String? {
-        let result = pactffi_generate_datetime_string(format.cString(using: .utf8))
+        let result = format.withUTF8CString { format in
+            pactffi_generate_datetime_string(format)
+        }
         guard result.tag == StringResult_Ok, let stringPointer = result.ok else {
             return nil
         }
@@ -293,14 +373,46 @@ struct DefaultPactFFIProvider: PactFFIProviding {
 
 private extension DefaultPactFFIProvider {
 
+    func applyHeaders(
+        _ headers: [CompiledInteractionSpec.Field],
+        handle: InteractionHandle,
+        interactionPart: InteractionPart,
+        strings: CStringArena.CStrings
+    ) throws {
+        for header in headers {
+            guard pactffi_with_header_v2(handle, interactionPart, strings[header.name], 0, header.value.map { strings[$0] }) else {
+                throw Interaction.Error.canNotBeModified
+            }
+        }
+    }
+
+    func applyBody(
+        _ body: CompiledInteractionSpec.Body?,
+        handle: InteractionHandle,
+        interactionPart: InteractionPart,
+        strings: CStringArena.CStrings
+    ) throws {
+        let isApplied: Bool
+        switch body {
+        case let .text(contentType, text)?:
+            isApplied = pactffi_with_body(handle, interactionPart, strings[contentType], text.map { strings[$0] })
+        case let .binary(contentType, data)?:
+            isApplied = data.withUnsafeBytes { bytes in
+                pactffi_with_binary_body(handle, interactionPart, strings[contentType], bytes.bindMemory(to: UInt8.self).baseAddress, bytes.count)
+            }
+        case nil:
+            isApplied = true
+        }
+        guard isApplied else {
+            throw Interaction.Error.canNotBeModified
+        }
+    }
+
     func removeHeader(name: String, handle: InteractionHandle, interactionPart: InteractionPart) throws {
-        guard pactffi_with_header_v2(
-            handle,
-            interactionPart,
-            name.cString(using: .utf8),
-            0,
-            "".cString(using: .utf8)
-        ) else {
+        let isApplied = withUTF8CStrings(name, "") { name, empty in
+            pactffi_with_header_v2(handle, interactionPart, name, 0, empty)
+        }
+        guard isApplied else {
             throw Interaction.Error.canNotBeModified
         }
     }
@@ -0,0 +1,59 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// Packs many strings into a single buffer of NUL terminated UTF-8 C strings.
+///
+/// Bridging each string with `cString(using:)` allocates an array per string. The arena copies every
+/// string into one buffer instead, and hands out the C string pointers for the duration of ``withCStrings(_:)``.
+struct CStringArena {
+
+    /// Refers to a string appended to the arena.
+    struct Reference {
+        fileprivate let offset: Int
+    }
+
+    /// Resolves a ``Reference`` to its C string.
+    struct CStrings {
+        fileprivate let baseAddress: UnsafePointer<CChar>
+
+        subscript(reference: Reference) -> UnsafePointer<CChar> {
+            baseAddress + reference.offset
+        }
+    }
+
+    private var storage: [CChar] = []
+
+    /// - Parameters:
+    ///   - capacity: The number of UTF-8 code units to reserve, including the NUL terminators.
+    init(capacity: Int = 0) {
+        storage.reserveCapacity(capacity)
+    }
+
+    // MARK: - Interface
+
+    /// Copies `string` into the arena.
+    mutating func append(_ string: String) -> Reference {
+        let reference = Reference(offset: storage.count)
+        storage.append(contentsOf: string.utf8.lazy.map { CChar(bitPattern: $0) })
+        storage.append(0)
+        return reference
+    }
+
+    /// Calls `body` with the C strings of the arena.
+    ///
+    /// - Warning: The pointers are only valid inside `body`.
+    func withCStrings<Result>(_ body: (CStrings) throws -> Result) rethrows -> Result {
+        try storage.withUnsafeBufferPointer { buffer in
+            guard let baseAddress = buffer.baseAddress else {
+                preconditionFailure("An arena must contain a string before its C strings are used")
+            }
+            return try body(CStrings(baseAddress: baseAddress))
+        }
+    }
+}
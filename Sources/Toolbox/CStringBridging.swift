@@ -0,0 +1,93 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+// Bridges Swift strings to the `const char *` arguments of the Pact FFI.
+//
+// `cString(using:)` allocates a new array for every argument of every call. Native Swift strings are
+// already stored as NUL terminated UTF-8, so `withCString` hands out a pointer to that storage without
+// copying. Strings bridged from Objective-C are not, and are copied into a stack buffer when short enough.
+
+extension String {
+
+    /// The largest string, in UTF-8 code units, copied into a stack buffer rather than onto the heap.
+    static let stackBufferCapacity = 1_024
+
+    /// Calls `body` with the string as a NUL terminated UTF-8 C string.
+    ///
+    /// - Warning: The pointer is only valid inside `body`.
+    ///
+    @inline(__always)
+    func withUTF8CString<Result>(_ body: (UnsafePointer<CChar>) throws -> Result) rethrows -> Result {
+        if isContiguousUTF8 {
+            return try withCString(body)
+        }
+
+        let count = utf8.count
+        guard count < Self.stackBufferCapacity else {
+            return try withCString(body)
+        }
+
+        return try withUnsafeTemporaryAllocation(of: CChar.self, capacity: count + 1) { buffer in
+            guard let baseAddress = buffer.baseAddress else {
+                preconditionFailure("A temporary allocation must have a base address")
+            }
+            var index = 0
+            for byte in utf8 {
+                buffer[index] = CChar(bitPattern: byte)
+                index += 1
+            }
+            buffer[index] = 0
+            return try body(baseAddress)
+        }
+    }
+}
+
+extension Optional where Wrapped == String {
+
+    /// Calls `body` with the string as a NUL terminated UTF-8 C string, or with `nil` when there is no string.
+    ///
+    /// - Warning: The pointer is only valid inside `body`.
+    ///
+    @inline(__always)
+    func withUTF8CString<Result>(_ body: (UnsafePointer<CChar>?) throws -> Result) rethrows -> Result {
+        guard let string = self else {
+            return try body(nil)
+        }
+        return try string.withUTF8CString { try body($0) }
+    }
+}
+
+/// Calls `body` with `first` and `second` as NUL terminated UTF-8 C strings.
+@inline(__always)
+func withUTF8CStrings<Result>(
+    _ first: String,
+    _ second: String,
+    _ body: (UnsafePointer<CChar>, UnsafePointer<CChar>) throws -> Result
+) rethrows -> Result {
+    try first.withUTF8CString { first in
+        try second.withUTF8CString { second in
+            try body(first, second)
+        }
+    }
+}
+
+/// Calls `body` with `first`, `second` and `third` as NUL terminated UTF-8 C strings.
+@inline(__always)
+func withUTF8CStrings<Result>(
+    _ first: String,
+    _ second: String,
+    _ third: String,
+    _ body: (UnsafePointer<CChar>, UnsafePointer<CChar>, UnsafePointer<CChar>) throws -> Result
+) rethrows -> Result {
+    try withUTF8CStrings(first, second) { first, second in
+        try third.withUTF8CString { third in
+            try body(first, second, third)
+        }
+    }
+}
@@ -0,0 +1,148 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// An ``InteractionSpec`` with all its strings serialised into a single ``CStringArena``.
+///
+/// Compiling resolves every header and query value into the form passed to the Pact FFI, so applying the
+/// same compiled spec to any number of interactions only makes the FFI calls.
+struct CompiledInteractionSpec: Sendable {
+
+    /// A header or query parameter name and its value. A `nil` value configures a query parameter without a value.
+    struct Field {
+        let name: CStringArena.Reference
+        let value: CStringArena.Reference?
+    }
+
+    enum Body {
+        case text(contentType: CStringArena.Reference, body: CStringArena.Reference?)
+        case binary(contentType: CStringArena.Reference, body: Data)
+    }
+
+    /// The spec this was compiled from.
+    let source: InteractionSpec
+
+    let arena: CStringArena
+    let method: CStringArena.Reference
+    let path: CStringArena.Reference
+    let query: [Field]
+    let requestHeaders: [Field]
+    let requestBody: Body?
+    let status: UInt16
+    let responseHeaders: [Field]
+    let responseBody: Body?
+
+    /// The request method and path, as recorded on the ``Interaction``.
+    let expectedRequest: (method: Interaction.HTTPMethod, path: String)
+
+    init(_ spec: InteractionSpec) {
+        source = spec
+        var arena = CStringArena(capacity: spec.utf8Count)
+
+        method = arena.append(spec.request.method.rawValue)
+        path = arena.append(spec.request.path)
+        query = spec.request.query.map { field in
+            Field(name: arena.append(field.name), value: field.values.isEmpty ? nil : arena.append(Self.value(of: field)))
+        }
+        requestHeaders = spec.request.headers.map { field in
+            Field(name: arena.append(field.name), value: arena.append(Self.value(of: field)))
+        }
+        requestBody = spec.request.body.map { Body($0, in: &arena) }
+        status = UInt16(spec.response.status)
+        responseHeaders = spec.response.headers.map { field in
+            Field(name: arena.append(field.name), value: arena.append(Self.value(of: field)))
+        }
+        responseBody = spec.response.body.map { Body($0, in: &arena) }
+        expectedRequest = (spec.request.method, spec.request.path)
+
+        self.arena = arena
+    }
+}
+
+// MARK: - Private
+
+private extension CompiledInteractionSpec {
+
+    /// The header or query parameter value for `field`.
+    ///
+    /// A single value is passed as is. Multiple values are passed as one JSON document, so the Pact core
+    /// configures all of them in a single call. An empty value removes a header.
+    ///
+    static func value(of field: InteractionSpec.Field) -> String {
+        switch field.values.count {
+        case 0:
+            return ""
+        case 1:
+            return field.values[0]
+        default:
+            return #"{"value":["# + field.values.map(\.jsonStringLiteral).joined(separator: ",") + "]}"
+        }
+    }
+}
+
+private extension CompiledInteractionSpec.Body {
+
+    init(_ body: InteractionSpec.Body, in arena: inout CStringArena) {
+        switch body {
+        case let .text(text, contentType):
+            self = .text(contentType: arena.append(contentType), body: text.map { arena.append($0) })
+        case let .binary(data, contentType):
+            self = .binary(contentType: arena.append(contentType), body: data)
+        }
+    }
+}
+
+private extension InteractionSpec {
+
+    /// The UTF-8 code units the spec's strings take up in a ``CStringArena``, including a terminator per string.
+    var utf8Count: Int {
+        func count(_ fields: [Field]) -> Int {
+            fields.reduce(0) { total, field in
+                // Multiple values are quoted and wrapped in a small JSON document.
+                total + field.name.utf8.count + field.values.reduce(0) { $0 + $1.utf8.count + 3 } + 16
+            }
+        }
+
+        func count(_ body: Body?) -> Int {
+            switch body {
+            case let .text(text, contentType)?:
+                return contentType.utf8.count + (text?.utf8.count ?? 0) + 2
+            case let .binary(_, contentType)?:
+                return contentType.utf8.count + 1
+            case nil:
+                return 0
+            }
+        }
+
+        return request.method.rawValue.utf8.count + request.path.utf8.count + 2
+            + count(request.query) + count(request.headers) + count(request.body)
+            + count(response.headers) + count(response.body)
+    }
+}
+
+private extension String {
+
+    /// The string as a quoted JSON string literal.
+    var jsonStringLiteral: String {
+        var literal = "\""
+        for scalar in unicodeScalars {
+            switch scalar {
+            case "\"": literal += "\\\""
+            case "\\": literal += "\\\\"
+            case "\n": literal += "\\n"
+            case "\r": literal += "\\r"
+            case "\t": literal += "\\t"
+            case let scalar where scalar.value < 0x20:
+                literal += String(format: "\\u%04x", scalar.value)
+            default:
+                literal.unicodeScalars.append(scalar)
+            }
+        }
+        return literal + "\""
+    }
+}
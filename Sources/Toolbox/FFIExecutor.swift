@@ -0,0 +1,65 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// Runs blocking Pact FFI calls away from the Swift concurrency thread pool.
+///
+/// Starting and cleaning up a mock server, and writing a Pact file, block the calling thread until the
+/// Pact core is done. Doing that on a cooperative thread starves every other task when hundreds of
+/// async tests run at once, so the work is dispatched onto a dedicated queue and the task is resumed
+/// once it completes.
+///
+/// At most ``width`` calls run at once. The rest wait in order on a serial admission queue, so GCD never
+/// spawns a thread for every blocked call when many tests shut their mock servers down together.
+enum FFIExecutor {
+
+    /// The maximum number of FFI calls run at once.
+    static let width = max(2, ProcessInfo.processInfo.activeProcessorCount)
+
+    private static let queue = DispatchQueue(
+        label: "au.com.pact-foundation.PactSwiftMockServer.ffi",
+        qos: .userInitiated,
+        attributes: .concurrent
+    )
+    private static let admission = DispatchQueue(label: "au.com.pact-foundation.PactSwiftMockServer.ffi-admission", qos: .userInitiated)
+    private static let slots = DispatchSemaphore(value: width)
+
+    /// Runs `work` on the FFI queue and returns its result.
+    static func run<T>(_ work: @escaping () throws -> T) async throws -> T {
+        try await withCheckedThrowingContinuation { continuation in
+            submit {
+                continuation.resume(with: Result { try work() })
+            }
+        }
+    }
+
+    /// Runs `work` on the FFI queue and returns its result.
+    static func run<T>(_ work: @escaping () -> T) async -> T {
+        await withCheckedContinuation { continuation in
+            submit {
+                continuation.resume(returning: work())
+            }
+        }
+    }
+}
+
+// MARK: - Private
+
+private extension FFIExecutor {
+
+    /// Runs `work` on `queue` once one of the ``width`` slots is free.
+    static func submit(_ work: @escaping () -> Void) {
+        admission.async {
+            slots.wait()
+            queue.async {
+                defer { slots.signal() }
+                work()
+            }
+        }
+    }
+}
@@ -0,0 +1,67 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// A serial executor running an actor's jobs on its own dispatch queue.
+///
+/// The Pact FFI calls made on a handle may block on the Pact core, so an actor owning a handle runs its jobs
+/// on a dedicated queue rather than a Swift concurrency thread. Jobs still run one at a time, in order.
+final class FFISerialExecutor: SerialExecutor, @unchecked Sendable {
+
+    private static let queueKey = DispatchSpecificKey<ObjectIdentifier>()
+
+    private let queue: DispatchQueue
+
+    /// - Parameters:
+    ///   - label: The label of the executor's dispatch queue.
+    init(label: String) {
+        queue = DispatchQueue(label: label, qos: .userInitiated, target: FFISerialExecutor.targetQueue)
+        queue.setSpecific(key: Self.queueKey, value: ObjectIdentifier(self))
+    }
+
+    // MARK: - Interface
+
+    /// `true` when called from a job running on this executor.
+    var isCurrent: Bool {
+        DispatchQueue.getSpecific(key: Self.queueKey) == ObjectIdentifier(self)
+    }
+
+    #if compiler(>=5.9)
+    @available(iOS 17.0, macOS 14.0, tvOS 17.0, watchOS 10.0, *)
+    func enqueue(_ job: consuming ExecutorJob) {
+        enqueue(UnownedJob(job))
+    }
+    #endif
+
+    /// Runs `job` on the executor's queue. Called directly by runtimes older than iOS 17 and macOS 14.
+    func enqueue(_ job: UnownedJob) {
+        queue.async {
+            #if compiler(>=5.9)
+            job.runSynchronously(on: self.asUnownedSerialExecutor())
+            #else
+            job._runSynchronously(on: self.asUnownedSerialExecutor())
+            #endif
+        }
+    }
+
+    func asUnownedSerialExecutor() -> UnownedSerialExecutor {
+        UnownedSerialExecutor(ordinary: self)
+    }
+}
+
+// MARK: - Private
+
+private extension FFISerialExecutor {
+
+    /// Every executor's queue targets one concurrent queue, so executors share a bounded pool of threads.
+    static let targetQueue = DispatchQueue(
+        label: "au.com.pact-foundation.PactSwiftMockServer.ffi-serial",
+        qos: .userInitiated,
+        attributes: .concurrent
+    )
+}
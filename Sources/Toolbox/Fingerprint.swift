@@ -0,0 +1,24 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// An in-memory record of the calls that configured a ``Pact`` or one of its ``Interaction``s.
+///
+/// The Pact core can only serialise a Pact by writing it to a file. Recording every successful call with
+/// its arguments lets two Pacts be compared without that round trip: Pacts configured with the same calls
+/// in the same order describe the same contract.
+final class Fingerprint {
+
+    /// The calls recorded so far, each as its name followed by its arguments.
+    private(set) var calls: [[AnyHashable]] = []
+
+    /// Records a successful call named `name` with its `arguments`.
+    func record(_ name: String, _ arguments: AnyHashable...) {
+        calls.append([AnyHashable(name)] + arguments)
+    }
+}
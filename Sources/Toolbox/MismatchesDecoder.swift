@@ -0,0 +1,213 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// Decodes the mock server mismatches JSON straight from the bytes of the FFI C string.
+///
+/// The mismatches document is a top-level JSON array. Rather than copying it into a `String` and then
+/// into `Data`, the array is scanned in place for its elements and each element is decoded through a
+/// `Data` view over the original buffer. Decoding stops as soon as `limit` failures have been decoded.
+enum MismatchesDecoder {
+
+    /// Decodes up to `limit` failures from `bytes`.
+    ///
+    /// - Throws: A `DecodingError` if `bytes` is not a JSON array of failures.
+    ///
+    /// - Parameters:
+    ///   - bytes: The UTF-8 encoded mismatches JSON, without the terminating null character.
+    ///   - limit: The maximum number of failures to decode; `nil` decodes every failure.
+    ///
+    static func decode(_ bytes: UnsafeBufferPointer<UInt8>, limit: Int? = nil) throws -> [PactVerificationFailure] {
+        guard let baseAddress = bytes.baseAddress else {
+            return []
+        }
+
+        let decoder = JSONDecoder()
+        var scanner = ElementScanner()
+        var failures: [PactVerificationFailure] = []
+
+        while limit.map({ failures.count < $0 }) ?? true, let range = try scanner.next(in: bytes)?.range {
+            let element = Data(
+                bytesNoCopy: UnsafeMutableRawPointer(mutating: baseAddress + range.lowerBound),
+                count: range.count,
+                deallocator: .none
+            )
+            failures.append(try decoder.decode(PactVerificationFailure.self, from: element))
+        }
+
+        return failures
+    }
+}
+
+// MARK: - Element scanner
+
+extension MismatchesDecoder {
+
+    /// Finds the byte ranges of the elements of a top-level JSON array one element at a time.
+    ///
+    /// While scanning an element the scanner also notes where the value of its top level `"type"` member is,
+    /// so elements can be told apart by type without decoding them.
+    ///
+    /// The scanner only keeps an offset, so the same buffer, or a copy of it, must be passed to every call.
+    struct ElementScanner {
+
+        /// An element of the array.
+        struct Element {
+
+            /// The byte range of the element.
+            let range: Range<Int>
+
+            /// The byte range of the raw value of the element's top level `"type"` string, without the quotes,
+            /// if the element is an object with one.
+            let type: Range<Int>?
+        }
+
+        private var offset = 0
+        private var started = false
+        private var finished = false
+        private var elementCount = 0
+
+        /// The next element, or `nil` once the end of the array has been reached.
+        ///
+        /// - Throws: A `DecodingError` if `bytes` is not a well formed JSON array.
+        ///
+        mutating func next(in bytes: UnsafeBufferPointer<UInt8>) throws -> Element? {
+            guard finished == false else {
+                return nil
+            }
+
+            var index = skipWhitespace(bytes, from: offset)
+            if started == false {
+                guard index < bytes.count, bytes[index] == Byte.openBracket else {
+                    throw corrupted("Expected mismatches to be a JSON array")
+                }
+                started = true
+                index = skipWhitespace(bytes, from: index + 1)
+            } else if index < bytes.count, bytes[index] == Byte.comma {
+                index = skipWhitespace(bytes, from: index + 1)
+            } else if index < bytes.count, bytes[index] != Byte.closeBracket {
+                throw corrupted("Expected ',' or ']' after element \(elementCount)")
+            }
+
+            guard index < bytes.count else {
+                throw corrupted("Unterminated mismatches JSON array")
+            }
+            if bytes[index] == Byte.closeBracket {
+                finished = true
+                return nil
+            }
+
+            let start = index
+            var depth = 0
+            var inString = false
+            var stringStart = 0
+            // Strings directly inside the element alternate between member names and values.
+            var expectsName = false
+            var isTypeValue = false
+            var type: Range<Int>?
+
+            scan: while index < bytes.count {
+                let byte = bytes[index]
+
+                if inString {
+                    if byte == Byte.backslash {
+                        index += 1
+                    } else if byte == Byte.quote {
+                        inString = false
+                        if depth == 1, type == nil {
+                            if expectsName {
+                                isTypeValue = Self.isTypeName(bytes, stringStart..<index)
+                                expectsName = false
+                            } else if isTypeValue {
+                                type = stringStart..<index
+                            }
+                        }
+                    }
+                    index += 1
+                    continue
+                }
+
+                switch byte {
+                case Byte.quote:
+                    inString = true
+                    stringStart = index + 1
+                case Byte.openBrace, Byte.openBracket:
+                    depth += 1
+                    expectsName = depth == 1 && byte == Byte.openBrace
+                case Byte.closeBrace where depth == 0, Byte.closeBracket where depth == 0, Byte.comma where depth == 0:
+                    break scan
+                case Byte.closeBrace, Byte.closeBracket:
+                    depth -= 1
+                case Byte.comma where depth == 1:
+                    expectsName = true
+                    isTypeValue = false
+                default:
+                    break
+                }
+                index += 1
+            }
+
+            guard index < bytes.count else {
+                throw corrupted("Unterminated mismatches JSON array")
+            }
+
+            offset = index
+            elementCount += 1
+            return Element(range: start..<trimmedEnd(bytes, from: start, to: index), type: type)
+        }
+    }
+}
+
+private extension MismatchesDecoder.ElementScanner {
+
+    static let typeName = Array("type".utf8)
+
+    static func isTypeName(_ bytes: UnsafeBufferPointer<UInt8>, _ range: Range<Int>) -> Bool {
+        range.count == typeName.count && bytes[range].elementsEqual(typeName)
+    }
+}
+
+// MARK: - Private
+
+private extension MismatchesDecoder {
+
+    enum Byte {
+        static let openBracket = UInt8(ascii: "[")
+        static let closeBracket = UInt8(ascii: "]")
+        static let openBrace = UInt8(ascii: "{")
+        static let closeBrace = UInt8(ascii: "}")
+        static let quote = UInt8(ascii: "\"")
+        static let backslash = UInt8(ascii: "\\")
+        static let comma = UInt8(ascii: ",")
+    }
+
+    static func isWhitespace(_ byte: UInt8) -> Bool {
+        byte == UInt8(ascii: " ") || byte == UInt8(ascii: "\n") || byte == UInt8(ascii: "\r") || byte == UInt8(ascii: "\t")
+    }
+
+    static func corrupted(_ description: String) -> DecodingError {
+        DecodingError.dataCorrupted(DecodingError.Context(codingPath: [], debugDescription: description))
+    }
+
+    static func skipWhitespace(_ bytes: UnsafeBufferPointer<UInt8>, from index: Int) -> Int {
+        var index = index
+        while index < bytes.count, isWhitespace(bytes[index]) {
+            index += 1
+        }
+        return index
+    }
+
+    /// The end of the element starting at `start`, excluding any whitespace before `end`.
+    static func trimmedEnd(_ bytes: UnsafeBufferPointer<UInt8>, from start: Int, to end: Int) -> Int {
+        var end = end
+        while end > start, isWhitespace(bytes[end - 1]) {
+            end -= 1
+        }
+        return end
+    }
+}
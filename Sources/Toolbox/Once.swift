@@ -0,0 +1,46 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// A flag guarding work that must run once per process, from whichever thread or task asks first.
+///
+/// Callers arriving while the work runs wait for it to finish; callers arriving after it has run only check the flag.
+final class Once: @unchecked Sendable {
+
+    private let lock = NSLock()
+    private var done = false
+
+    // MARK: - Interface
+
+    /// Whether the work has run.
+    var isDone: Bool {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return done
+    }
+
+    /// Runs `body` unless a previous call already ran it.
+    ///
+    /// The flag is set before `body` runs, so work that throws is not retried.
+    ///
+    /// - Returns: `true` if this call ran `body`.
+    ///
+    @discardableResult
+    func run(_ body: () throws -> Void) rethrows -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard done == false else {
+            return false
+        }
+        done = true
+        try body()
+        return true
+    }
+}
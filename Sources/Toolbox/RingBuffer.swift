@@ -0,0 +1,79 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// A fixed capacity FIFO queue for many producers and one consumer.
+///
+/// Storage is allocated once. Pushing never waits on the consumer: when the buffer is full the element is
+/// dropped and counted instead. The lock is only held to move an index, never while the consumer handles
+/// the elements it has drained.
+final class RingBuffer<Element>: @unchecked Sendable {
+
+    /// The number of elements the buffer holds.
+    let capacity: Int
+
+    private let lock = NSLock()
+    private var storage: [Element?]
+    private var head = 0
+    private var count = 0
+    private var droppedCount = 0
+
+    /// - Parameters:
+    ///   - capacity: The number of elements the buffer holds.
+    init(capacity: Int) {
+        precondition(capacity > 0, "The ring buffer capacity must be greater than zero!")
+        self.capacity = capacity
+        self.storage = Array(repeating: nil, count: capacity)
+    }
+
+    // MARK: - Interface
+
+    /// The number of elements dropped because the buffer was full.
+    var dropped: Int {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return droppedCount
+    }
+
+    /// Appends `element`, or drops it if the buffer is full.
+    ///
+    /// - Returns: `true` if `element` was appended.
+    ///
+    @discardableResult
+    func push(_ element: Element) -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard count < capacity else {
+            droppedCount += 1
+            return false
+        }
+        storage[(head + count) % capacity] = element
+        count += 1
+        return true
+    }
+
+    /// Removes and returns every element in the buffer, oldest first.
+    func drain() -> [Element] {
+        lock.lock()
+        defer { lock.unlock() }
+
+        var elements: [Element] = []
+        elements.reserveCapacity(count)
+        while count > 0 {
+            if let element = storage[head] {
+                elements.append(element)
+            }
+            storage[head] = nil
+            head = (head + 1) % capacity
+            count -= 1
+        }
+        return elements
+    }
+}
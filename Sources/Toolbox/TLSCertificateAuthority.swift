@@ -0,0 +1,189 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+#if canImport(FoundationNetworking)
+import FoundationNetworking
+#endif
+
+#if canImport(Security)
+import Security
+#endif
+
+/// The CA certificate the Pact mock servers sign their self-signed TLS certificates with.
+///
+/// Every HTTPS mock server in the process uses the same CA, so the certificate is fetched from the Pact
+/// FFI and parsed only once. ``urlSession`` anchors trust on it and is shared between tests, which keeps
+/// connections and TLS sessions to the mock servers alive instead of paying for a full handshake and a
+/// trust evaluation on every request.
+///
+/// - Note: ``urlSession`` needs the Security framework to anchor trust on the CA, so it is only available on Apple platforms.
+///
+final class TLSCertificateAuthority {
+
+    /// The certificate authority of the Pact mock servers started through the Pact FFI.
+    static let shared = TLSCertificateAuthority(ffiProvider: DefaultPactFFIProvider())
+
+    private struct Certificate {
+        let pem: String?
+        #if canImport(Security)
+        let anchor: SecCertificate?
+        #endif
+    }
+
+    private let ffiProvider: PactFFIProviding
+    private let lock = NSLock()
+    private var certificate: Certificate?
+    #if canImport(Security)
+    private var session: URLSession?
+    #endif
+
+    init(ffiProvider: PactFFIProviding) {
+        self.ffiProvider = ffiProvider
+    }
+
+    #if canImport(Security)
+    deinit {
+        session?.finishTasksAndInvalidate()
+    }
+    #endif
+
+    // MARK: - Interface
+
+    /// The PEM encoded CA certificate, or `nil` if the Pact FFI could not provide it.
+    var pem: String? {
+        loadCertificate().pem
+    }
+
+    #if canImport(Security)
+    /// A `URLSession` that trusts HTTPS mock servers signed by this certificate authority.
+    ///
+    /// - Note: Only server trust challenges from the loopback interface are evaluated against the CA.
+    ///
+    var urlSession: URLSession {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let session = session {
+            return session
+        }
+
+        let configuration = URLSessionConfiguration.ephemeral
+        configuration.urlCache = nil
+
+        let session = URLSession(configuration: configuration, delegate: TrustDelegate(authority: self), delegateQueue: nil)
+        self.session = session
+        return session
+    }
+    #endif
+
+    /// Decodes the DER bytes of the first certificate in `pem`.
+    static func der(fromPEM pem: String) -> Data? {
+        var base64 = ""
+        var isInCertificate = false
+
+        for line in pem.split(whereSeparator: \.isNewline) {
+            if line.hasPrefix("-----BEGIN") {
+                isInCertificate = true
+            } else if line.hasPrefix("-----END") {
+                return isInCertificate ? Data(base64Encoded: base64) : nil
+            } else if isInCertificate {
+                base64 += line.trimmingCharacters(in: .whitespaces)
+            }
+        }
+
+        return nil
+    }
+}
+
+// MARK: - Private
+
+private extension TLSCertificateAuthority {
+
+    static let loopbackHosts: Set<String> = ["127.0.0.1", "localhost", "::1"]
+
+    func loadCertificate() -> Certificate {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let certificate = certificate {
+            return certificate
+        }
+
+        // An empty string is how the Pact FFI reports it could not read the certificate.
+        let pem = ffiProvider.tlsCACertificate().flatMap { $0.isEmpty ? nil : $0 }
+
+        #if canImport(Security)
+        let anchor = pem
+            .flatMap(Self.der(fromPEM:))
+            .flatMap { SecCertificateCreateWithData(nil, $0 as CFData) }
+        let certificate = Certificate(pem: pem, anchor: anchor)
+        #else
+        let certificate = Certificate(pem: pem)
+        #endif
+
+        self.certificate = certificate
+        return certificate
+    }
+
+    #if canImport(Security)
+    /// Evaluates `trust` with the CA as its only anchor.
+    ///
+    /// The host name is not checked as mock servers are only reached through the loopback interface,
+    /// where their certificate's subject does not necessarily match the address used.
+    ///
+    func trusts(_ trust: SecTrust) -> Bool {
+        guard let anchor = loadCertificate().anchor else {
+            return false
+        }
+
+        SecTrustSetPolicies(trust, SecPolicyCreateSSL(true, nil))
+        SecTrustSetAnchorCertificates(trust, [anchor] as CFArray)
+        SecTrustSetAnchorCertificatesOnly(trust, true)
+
+        var error: CFError?
+        guard SecTrustEvaluateWithError(trust, &error) else {
+            Logging.log(.error, message: "Mock server certificate is not trusted: \(error.map { "\($0)" } ?? "unknown error")")
+            return false
+        }
+        return true
+    }
+
+    final class TrustDelegate: NSObject, URLSessionDelegate {
+
+        // The authority owns the session, which owns its delegate. A challenge can still arrive while the
+        // session is being invalidated after the authority is gone.
+        private weak var authority: TLSCertificateAuthority?
+
+        init(authority: TLSCertificateAuthority) {
+            self.authority = authority
+        }
+
+        func urlSession(
+            _ session: URLSession,
+            didReceive challenge: URLAuthenticationChallenge,
+            completionHandler: @escaping (URLSession.AuthChallengeDisposition, URLCredential?) -> Void
+        ) {
+            guard
+                challenge.protectionSpace.authenticationMethod == NSURLAuthenticationMethodServerTrust,
+                TLSCertificateAuthority.loopbackHosts.contains(challenge.protectionSpace.host),
+                let trust = challenge.protectionSpace.serverTrust
+            else {
+                completionHandler(.performDefaultHandling, nil)
+                return
+            }
+
+            if let authority = authority, authority.trusts(trust) {
+                completionHandler(.useCredential, URLCredential(trust: trust))
+            } else {
+                completionHandler(.cancelAuthenticationChallenge, nil)
+            }
+        }
+    }
+    #endif
+}
@@ -0,0 +1,81 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class CStringBridgingTests: XCTestCase {
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try Logging.initialize()
+    }
+
+    // MARK: - Tests
+
+    func testBridgesNativeString() {
+        let string = "X-Request-Identifier: ✅"
+
+        XCTAssertEqual(string.withUTF8CString { String(cString: $0) }, string)
+    }
+
+    func testBridgesObjectiveCStringThroughStackBuffer() {
+        let string = NSString(string: "X-Request-Identifier: ✅") as String
+
+        XCTAssertEqual(string.withUTF8CString { String(cString: $0) }, string)
+    }
+
+    func testBridgesLongObjectiveCString() {
+        let string = NSString(string: String(repeating: "pact ", count: String.stackBufferCapacity)) as String
+
+        XCTAssertEqual(string.withUTF8CString { String(cString: $0) }, string)
+    }
+
+    func testBridgesOptionalString() {
+        XCTAssertNil(String?.none.withUTF8CString { $0 })
+        XCTAssertEqual(String?.some("pact").withUTF8CString { $0.map { String(cString: $0) } }, "pact")
+    }
+
+    // MARK: - Allocations
+
+    func testNativeStringBridgingDoesNotAllocate() throws {
+        let name = "X-Request-Identifier-Header"
+
+        let allocations = try AllocationCounter.count {
+            _ = name.withUTF8CString { strlen($0) }
+        }
+
+        XCTAssertEqual(allocations, 0)
+    }
+
+    func testFFICallsDoNotAllocate() throws {
+        // The message is only handed to the Pact core, through the bridge, when its level passes the filter
+        try XCTSkipUnless(Logging.isEnabled(.debug), "Logging at debug level is needed to bridge the log message")
+
+        let ffiProvider = DefaultPactFFIProvider()
+        let pact = Pact(consumer: "consumer", provider: "provider")
+        let handle = ffiProvider.newInteraction(handle: pact.handle, description: "an interaction to count allocations for")
+        let name = "X-Request-Identifier-Header"
+        let value = "7f9c2ba4e88f827d616045507605853e"
+        let values = ["first-query-value", "second-query-value"]
+
+        func configure() throws {
+            try ffiProvider.withRequest(handle: handle, method: .GET, path: "/allocations/counted")
+            try ffiProvider.withHeader(handle: handle, name: name, value: value, interactionPart: .request)
+            try ffiProvider.withQueryParameter(handle: handle, name: name, values: values)
+            try ffiProvider.given(handle: handle, description: "allocations are counted")
+            Logging.log(.debug, message: "Counting allocations of the FFI bridging layer")
+        }
+
+        // Warm up once so lazily initialised state is not counted.
+        try configure()
+        let allocations = try AllocationCounter.count { try configure() }
+
+        XCTAssertEqual(allocations, 0)
+    }
+}
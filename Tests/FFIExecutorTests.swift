@@ -0,0 +1,73 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class FFIExecutorTests: XCTestCase {
+
+    func testRunsAtMostWidthCallsAtOnce() async {
+        let tracker = ConcurrencyTracker()
+
+        await withTaskGroup(of: Void.self) { group in
+            for _ in 0..<(FFIExecutor.width * 4) {
+                group.addTask {
+                    await FFIExecutor.run {
+                        tracker.enter()
+                        Thread.sleep(forTimeInterval: 0.01)
+                        tracker.leave()
+                    }
+                }
+            }
+        }
+
+        XCTAssertGreaterThan(tracker.peak, 0)
+        XCTAssertLessThanOrEqual(tracker.peak, FFIExecutor.width)
+    }
+
+    func testRethrowsErrors() async {
+        struct Failure: Swift.Error { }
+
+        do {
+            _ = try await FFIExecutor.run { () throws -> Int in throw Failure() }
+            XCTFail("Expected the error to be rethrown")
+        } catch {
+            XCTAssertTrue(error is Failure)
+        }
+    }
+}
+
+// MARK: - Private
+
+private final class ConcurrencyTracker: @unchecked Sendable {
+    private let lock = NSLock()
+    private var running = 0
+    private var maximum = 0
+
+    var peak: Int {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return maximum
+    }
+
+    func enter() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        running += 1
+        maximum = max(maximum, running)
+    }
+
+    func leave() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        running -= 1
+    }
+}
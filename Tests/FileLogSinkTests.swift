@@ -0,0 +1,140 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class FileLogSinkTests: XCTestCase {
+
+    private var logDirectory: URL!
+
+    private var logPath: String {
+        logDirectory.appendingPathComponent("pact.log").path
+    }
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try Logging.initialize()
+
+        logDirectory = FileManager.default.temporaryDirectory.appendingPathComponent("logs-\(UUID().uuidString)", isDirectory: true)
+    }
+
+    override func tearDown() async throws {
+        try? FileManager.default.removeItem(at: logDirectory)
+        try await super.tearDown()
+    }
+
+    // MARK: - Tests
+
+    func testWritesMessagesInOneBatch() throws {
+        let marker = UUID().uuidString
+        let sink = FileLogSink(path: logPath, source: .messages(filter: .trace), flushInterval: 60)
+        sink.start()
+        defer { sink.stop() }
+
+        XCTAssertTrue(Logging.isEnabled(.trace))
+        for index in 0..<10 {
+            Logging.log(.trace, message: "\(marker) \(index)")
+        }
+        XCTAssertFalse(FileManager.default.fileExists(atPath: logPath))
+
+        sink.flush()
+
+        let lines = try String(contentsOfFile: logPath).split(separator: "\n").filter { $0.contains(marker) }
+        XCTAssertEqual(lines.count, 10)
+        XCTAssertTrue(lines[0].hasSuffix("TRACE pact_swift: \(marker) 0"))
+        XCTAssertGreaterThanOrEqual(sink.statistics.records, 10)
+    }
+
+    func testStopsTakingMessagesWhenStopped() throws {
+        let marker = UUID().uuidString
+        let sink = FileLogSink(path: logPath, source: .messages(filter: .trace), flushInterval: 60)
+        sink.start()
+        Logging.log(.info, message: "\(marker) before")
+        sink.stop()
+
+        Logging.log(.info, message: "\(marker) after")
+        XCTAssertFalse(Logging.isEnabled(.trace))
+
+        let contents = try String(contentsOfFile: logPath)
+        XCTAssertTrue(contents.contains("\(marker) before"))
+        XCTAssertFalse(contents.contains("\(marker) after"))
+    }
+
+    func testRotatesFilesAboveMaxFileSize() throws {
+        let sink = FileLogSink(path: logPath, source: .messages(filter: .trace), maxFileSize: 256, maxRotatedFiles: 2, flushInterval: 60)
+        sink.start()
+        defer { sink.stop() }
+
+        for batch in 0..<5 {
+            for index in 0..<4 {
+                Logging.log(.debug, message: "rotated batch \(batch) line \(index)")
+            }
+            sink.flush()
+        }
+
+        let fileManager = FileManager.default
+        XCTAssertTrue(fileManager.fileExists(atPath: logPath))
+        XCTAssertTrue(fileManager.fileExists(atPath: "\(logPath).1"))
+        XCTAssertTrue(fileManager.fileExists(atPath: "\(logPath).2"))
+        XCTAssertFalse(fileManager.fileExists(atPath: "\(logPath).3"))
+        XCTAssertGreaterThan(sink.statistics.rotations, 0)
+        XCTAssertTrue(try String(contentsOfFile: logPath).contains("rotated batch 4"))
+    }
+
+    func testDropsMessagesAboveCapacity() throws {
+        let marker = UUID().uuidString
+        let sink = FileLogSink(path: logPath, source: .messages(filter: .trace), flushInterval: 60, capacity: 4)
+        sink.start()
+        defer { sink.stop() }
+
+        for index in 0..<10 {
+            Logging.log(.info, message: "\(marker) \(index)")
+        }
+        sink.flush()
+
+        let lines = try String(contentsOfFile: logPath).split(separator: "\n").filter { $0.contains(marker) }
+        XCTAssertEqual(lines.count, 4)
+        XCTAssertEqual(sink.statistics.dropped, 6)
+    }
+
+    func testDefaultsToBoundedMessagesSource() {
+        let sink = FileLogSink(path: logPath)
+
+        XCTAssertEqual(sink.messageFilter, .info)
+        XCTAssertEqual(sink.capacity, 8_192)
+    }
+
+    func testWritesLinesFromTheBuffer() throws {
+        let marker = UUID().uuidString
+        let sink = FileLogSink(path: logPath, source: .buffer, flushInterval: 60)
+        sink.start()
+        defer { sink.stop() }
+
+        Logging.log(.info, message: marker)
+        sink.flush()
+
+        XCTAssertGreaterThan(sink.statistics.records, 0)
+        XCTAssertTrue(try String(contentsOfFile: logPath).contains(marker))
+    }
+
+    // MARK: - Benchmarks
+
+    func testPerformance_LoggingToSink() {
+        let sink = FileLogSink(path: logPath, source: .messages(filter: .debug), flushInterval: 0.05, capacity: 100_000)
+        sink.start()
+        defer { sink.stop() }
+
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            for index in 0..<10_000 {
+                Logging.log(.debug, message: "Mock server handled request \(index)")
+            }
+            sink.flush()
+        }
+    }
+}
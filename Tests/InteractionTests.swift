@@ -13,7 +13,7 @@ final class InteractionTests: XCTestCase {
 
     override func setUp() async throws {
         try await super.setUp()
-        try await Logging.initialize()
+        try Logging.initialize()
     }
 
     // MARK: - Tests
@@ -220,5 +220,219 @@ final class InteractionTests: XCTestCase {
             Interaction.Error.panic(nil).failureReason,
             "Function panicked (error: )"
         )
+
+        // Test multipartFileFailed error with message
+        XCTAssertEqual(
+            Interaction.Error.multipartFileFailed("No such file").failureReason,
+            "Can not add multipart file (error: No such file)"
+        )
+    }
+
+    // MARK: - InteractionSpec
+
+    func testApplyingSpecConfiguresSameInteractionAsBuilders() throws {
+        let builtPact = try Pact(consumer: "consumer", provider: "provider").withSpecification(.v4)
+        try Interaction(pactHandle: builtPact.handle, description: "An interaction")
+            .withRequest(method: .POST, path: "/test") { request in
+                try request.queryParam(name: "foo", values: ["bar", "baz"])
+                try request.queryParam(name: "flag", values: [])
+                try request.header("X-Single", value: "one")
+                try request.header("X-Multiple", values: ["one", #"two "quoted""#])
+                try request.body(#"{"foo":"bar"}"#, contentType: "application/json")
+            }
+            .willRespond(with: TestStatusCode.ok.rawValue) { response in
+                try response.header("FOO", value: "BAR")
+                try response.body(Data([0, 1, 2, 3]), contentType: "application/octet-stream")
+            }
+
+        let specPact = try Pact(consumer: "consumer", provider: "provider").withSpecification(.v4)
+        let spec = InteractionSpec(
+            request: InteractionSpec.Request(
+                method: .POST,
+                path: "/test",
+                query: [.init("foo", values: ["bar", "baz"]), .init("flag", values: [])],
+                headers: [.init("X-Single", values: ["one"]), .init("X-Multiple", values: ["one", #"two "quoted""#])],
+                body: .text(#"{"foo":"bar"}"#, contentType: "application/json")
+            ),
+            response: InteractionSpec.Response(
+                status: TestStatusCode.ok.rawValue,
+                headers: [.init("FOO", values: ["BAR"])],
+                body: .binary(Data([0, 1, 2, 3]), contentType: "application/octet-stream")
+            )
+        )
+        let interaction = try Interaction(pactHandle: specPact.handle, description: "An interaction").apply(spec)
+
+        XCTAssertEqual(try interactions(in: specPact), try interactions(in: builtPact))
+        XCTAssertEqual(interaction.expectedRequest?.method, .POST)
+        XCTAssertEqual(interaction.expectedRequest?.path, "/test")
+    }
+
+    // MARK: - InteractionTemplate
+
+    func testStampingTemplateConfiguresSameInteractionAsSpec() throws {
+        let spec = InteractionSpec(
+            request: InteractionSpec.Request(
+                method: .POST,
+                path: "/test",
+                query: [.init("foo", values: ["bar", "baz"])],
+                headers: [.init("X-Multiple", values: ["one", "two"])],
+                body: .text(#"{"foo":"bar"}"#, contentType: "application/json")
+            ),
+            response: InteractionSpec.Response(status: TestStatusCode.ok.rawValue, headers: [.init("FOO", values: ["BAR"])])
+        )
+        let template = InteractionTemplate("An interaction", providerStates: ["Some provider state"], spec: spec)
+
+        let specPact = try Pact(consumer: "consumer", provider: "provider").withSpecification(.v4)
+        try Interaction(pactHandle: specPact.handle, description: "An interaction")
+            .given("Some provider state")
+            .apply(spec)
+
+        for _ in 0..<2 {
+            let templatePact = try Pact(consumer: "consumer", provider: "provider").withSpecification(.v4)
+            let interaction = try template.stamp(into: templatePact)
+
+            XCTAssertEqual(try interactions(in: templatePact), try interactions(in: specPact))
+            XCTAssertEqual(templatePact.interactions.count, 1)
+            XCTAssertEqual(interaction.expectedRequest?.path, "/test")
+        }
+    }
+
+    func testStampingTemplateSubstitutesParameters() throws {
+        var spec = InteractionSpec(path: "/users/{{id}}", status: TestStatusCode.ok.rawValue)
+        spec.response.body = .text(#"{"id":"{{id}}"}"#, contentType: "application/json")
+        let template = InteractionTemplate(
+            "a request for user {{id}}",
+            providerStates: [Interaction.ProviderState(description: "user {{id}} exists", name: "id", value: "{{id}}")],
+            spec: spec
+        )
+
+        let pact = try Pact(consumer: "consumer", provider: "provider").withSpecification(.v4)
+        let first = try template.stamp(into: pact, parameters: ["id": "1"])
+        let second = try template.stamp(into: pact, parameters: ["id": "2"])
+
+        XCTAssertEqual(first.expectedRequest?.path, "/users/1")
+        XCTAssertEqual(second.expectedRequest?.path, "/users/2")
+
+        let stamped = try XCTUnwrap(try interactions(in: pact) as? [[String: Any]])
+        XCTAssertEqual(stamped.compactMap { $0["description"] as? String }, ["a request for user 1", "a request for user 2"])
+
+        let contents = try XCTUnwrap(String(data: try pact.contents(), encoding: .utf8))
+        XCTAssertFalse(contents.contains("{{id}}"))
+        XCTAssertTrue(contents.contains("user 2 exists"))
+    }
+
+    func testStampingTemplateDoesNotSubstituteIntoValues() throws {
+        let template = InteractionTemplate("a request for {{a}}", spec: InteractionSpec(path: "/{{a}}/{{b}}/{{c}}", status: TestStatusCode.ok.rawValue))
+        let pact = try Pact(consumer: "consumer", provider: "provider").withSpecification(.v4)
+
+        let interaction = try template.stamp(into: pact, parameters: ["a": "{{b}}", "b": "{{a}}"])
+
+        XCTAssertEqual(interaction.expectedRequest?.path, "/{{b}}/{{a}}/{{c}}")
+    }
+
+    // MARK: - Benchmarks
+
+    func testPerformance_Builders100Interactions() {
+        measure(metrics: [XCTClockMetric(), XCTCPUMetric(), XCTMemoryMetric()]) {
+            let pact = Pact(consumer: "consumer", provider: "provider")
+            for index in 0..<100 {
+                _ = try? Interaction(pactHandle: pact.handle, description: "An interaction \(index)")
+                    .withRequest(path: "/test") { request in
+                        try request.header("Accept", value: "application/json")
+                        try request.queryParam(name: "page", values: ["1"])
+                    }
+                    .willRespond(with: TestStatusCode.ok.rawValue) { response in
+                        try response.body("[]", contentType: "application/json")
+                    }
+            }
+        }
+    }
+
+    func testPerformance_Template100Interactions() {
+        let spec = InteractionSpec(
+            request: InteractionSpec.Request(path: "/test", query: [.init("page", values: ["1"])], headers: [.init("Accept", values: ["application/json"])]),
+            response: InteractionSpec.Response(status: TestStatusCode.ok.rawValue, body: .text("[]", contentType: "application/json"))
+        )
+        let templates = (0..<100).map { InteractionTemplate("An interaction \($0)", spec: spec) }
+
+        measure(metrics: [XCTClockMetric(), XCTCPUMetric(), XCTMemoryMetric()]) {
+            let pact = Pact(consumer: "consumer", provider: "provider")
+            for template in templates {
+                _ = try? template.stamp(into: pact)
+            }
+        }
+    }
+
+    func testPerformance_BuildersWith50HeadersAnd50QueryParams() {
+        let fields = Self.fields(count: 50)
+
+        measure(metrics: [XCTClockMetric(), XCTCPUMetric(), XCTMemoryMetric()]) {
+            let pact = Pact(consumer: "consumer", provider: "provider")
+            _ = try? Interaction(pactHandle: pact.handle, description: "An interaction")
+                .withRequest(path: "/test") { request in
+                    for field in fields {
+                        try request.queryParam(name: field.name, values: field.values)
+                        try request.header(field.name, values: field.values)
+                    }
+                }
+                .willRespond(with: TestStatusCode.ok.rawValue)
+        }
+    }
+
+    func testPerformance_SpecWith50HeadersAnd50QueryParams() {
+        let spec = InteractionSpec(
+            request: InteractionSpec.Request(path: "/test", query: Self.fields(count: 50), headers: Self.fields(count: 50)),
+            response: InteractionSpec.Response(status: TestStatusCode.ok.rawValue)
+        )
+
+        measure(metrics: [XCTClockMetric(), XCTCPUMetric(), XCTMemoryMetric()]) {
+            let pact = Pact(consumer: "consumer", provider: "provider")
+            _ = try? Interaction(pactHandle: pact.handle, description: "An interaction").apply(spec)
+        }
+    }
+
+    func testPerformance_MultipartFile1MB() throws {
+        try measureMultipartFile(megabytes: 1)
+    }
+
+    func testPerformance_MultipartFile16MB() throws {
+        try measureMultipartFile(megabytes: 16)
+    }
+
+    func testPerformance_MultipartFile64MB() throws {
+        try measureMultipartFile(megabytes: 64)
+    }
+}
+
+// MARK: - Private
+
+private extension InteractionTests {
+
+    static func fields(count: Int) -> [InteractionSpec.Field] {
+        (0..<count).map { .init("X-Field-\($0)", values: ["first-\($0)", "second-\($0)"]) }
+    }
+
+    /// Measures the memory of adding a multipart file of `megabytes` to a request.
+    func measureMultipartFile(megabytes: Int) throws {
+        let fileURL = FileManager.default.temporaryDirectory.appendingPathComponent("\(UUID().uuidString).bin")
+        XCTAssertTrue(FileManager.default.createFile(atPath: fileURL.path, contents: nil))
+        defer { try? FileManager.default.removeItem(at: fileURL) }
+
+        let fileHandle = try FileHandle(forWritingTo: fileURL)
+        try fileHandle.truncate(atOffset: UInt64(megabytes * 1_024 * 1_024))
+        try fileHandle.close()
+
+        measure(metrics: [XCTMemoryMetric(), XCTClockMetric()]) {
+            let pact = Pact(consumer: "consumer", provider: "provider")
+            _ = try? Interaction(pactHandle: pact.handle, description: "An interaction")
+                .withRequest(method: .POST, path: "/uploads") { request in
+                    try request.multipart(part: "file", file: fileURL, contentType: "application/octet-stream")
+                }
+        }
+    }
+
+    func interactions(in pact: Pact) throws -> NSArray {
+        let json = try XCTUnwrap(try JSONSerialization.jsonObject(with: pact.contents()) as? [String: Any])
+        return try XCTUnwrap(json["interactions"] as? NSArray)
     }
 }
@@ -0,0 +1,151 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class LoggingTests: XCTestCase {
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try Logging.initialize()
+    }
+
+    // MARK: - Tests
+
+    func testFiltersAreOrderedByVerbosity() {
+        XCTAssertEqual([Logging.Filter.trace, .off, .info, .error, .debug, .warn].sorted(), [.off, .error, .warn, .info, .debug, .trace])
+    }
+
+    func testLogsAtConfiguredLevels() {
+        // Every sink configuration in the test bundle logs errors; none logs at trace.
+        XCTAssertTrue(Logging.isEnabled(.error))
+        XCTAssertFalse(Logging.isEnabled(.trace))
+    }
+
+    func testDoesNotEvaluateFilteredMessages() {
+        var evaluated = false
+        func message() -> String {
+            evaluated = true
+            return "filtered"
+        }
+
+        Logging.log(.trace, message: message())
+        XCTAssertFalse(evaluated)
+
+        Logging.log(.error, message: message())
+        XCTAssertTrue(evaluated)
+    }
+
+    func testInitializesFromAnyThread() {
+        DispatchQueue.concurrentPerform(iterations: 16) { _ in
+            XCTAssertNoThrow(try Logging.initialize())
+            XCTAssertTrue(Logging.isInitialized)
+        }
+    }
+
+    func testOnceRunsOnlyTheFirstCall() {
+        let once = Once()
+        let lock = NSLock()
+        var runs: [Int] = []
+
+        DispatchQueue.concurrentPerform(iterations: 16) { index in
+            once.run {
+                lock.lock()
+                runs.append(index)
+                lock.unlock()
+            }
+        }
+
+        XCTAssertEqual(runs.count, 1)
+        XCTAssertTrue(once.isDone)
+        XCTAssertFalse(once.run { XCTFail("Ran twice") })
+    }
+
+    func testOnceDoesNotRetryWorkThatThrows() {
+        struct Failure: Swift.Error { }
+        let once = Once()
+
+        XCTAssertThrowsError(try once.run { throw Failure() })
+        XCTAssertFalse(once.run { XCTFail("Retried") })
+    }
+
+    // MARK: - LogCursor
+
+    func testCursorReadsOnlyNewLines() {
+        let cursor = LogCursor()
+        let first = "first \(UUID().uuidString)"
+        let second = "second \(UUID().uuidString)"
+
+        Logging.log(.info, message: first)
+        XCTAssertTrue(cursor.read().contains { $0.contains(first) })
+
+        Logging.log(.info, message: second)
+        let secondRead = cursor.read()
+
+        XCTAssertTrue(secondRead.contains { $0.contains(second) })
+        XCTAssertFalse(secondRead.contains { $0.contains(first) })
+        XCTAssertTrue(cursor.read().isEmpty)
+    }
+
+    func testCursorCapsRetainedLines() {
+        let cursor = LogCursor(retainedLimit: 256)
+
+        for index in 0..<20 {
+            Logging.log(.info, message: "retained line \(index) \(UUID().uuidString)")
+            _ = cursor.read()
+        }
+
+        XCTAssertLessThanOrEqual(cursor.retained.utf8.count, 256 + 20)
+        XCTAssertTrue(cursor.retained.contains("retained line 19"))
+        XCTAssertFalse(cursor.retained.contains("retained line 0 "))
+    }
+
+    func testCursorRetainsNothingByDefault() {
+        let cursor = LogCursor()
+        let marker = UUID().uuidString
+
+        Logging.log(.info, message: marker)
+
+        XCTAssertTrue(cursor.read().contains { $0.contains(marker) })
+        XCTAssertTrue(cursor.retained.isEmpty)
+    }
+
+    // MARK: - Benchmarks
+
+    func testPerformance_CursorReads() {
+        let cursor = LogCursor()
+
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            for index in 0..<100 {
+                Logging.log(.info, message: "Cursor read \(index)")
+                _ = cursor.read()
+            }
+        }
+    }
+
+    func testPerformance_ParallelInitialization() {
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            DispatchQueue.concurrentPerform(iterations: 16) { _ in
+                for _ in 0..<1_000 {
+                    try? Logging.initialize()
+                }
+            }
+        }
+    }
+
+    func testPerformance_FilteredMessages() {
+        let port = 21_337
+
+        measure(metrics: [XCTClockMetric(), XCTMemoryMetric()]) {
+            for index in 0..<100_000 {
+                Logging.log(.trace, message: "Mock server on port \(port) handled request \(index)")
+            }
+        }
+    }
+}
@@ -0,0 +1,154 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class MatcherTests: XCTestCase {
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try Logging.initialize()
+    }
+
+    // MARK: - Tests
+
+    func testSerialisesMatchersAsIntegrationJson() throws {
+        let body = MatchingBody {
+            ("id", .integer(1))
+            ("name", .like("Mary"))
+            ("balance", .decimal(10.5))
+            ("active", .boolean(true))
+            ("email", .regex(#"\w+@\w+\.com"#, example: "mary@example.com"))
+            ("createdAt", .datetime("yyyy-MM-dd'T'HH:mm:ss", example: "2026-10-17T09:00:00"))
+            ("tags", .eachLike("admin", min: 2))
+            ("note", nil)
+            ("address", .object {
+                ("street", .includes("Main"))
+                ("postcode", .equal(to: "3000"))
+            })
+        }
+
+        let expected = #"""
+        {
+            "id": {"pact:matcher:type": "integer", "value": 1},
+            "name": {"pact:matcher:type": "type", "value": "Mary"},
+            "balance": {"pact:matcher:type": "decimal", "value": 10.5},
+            "active": {"pact:matcher:type": "boolean", "value": true},
+            "email": {"pact:matcher:type": "regex", "regex": "\\w+@\\w+\\.com", "value": "mary@example.com"},
+            "createdAt": {"pact:matcher:type": "datetime", "format": "yyyy-MM-dd'T'HH:mm:ss", "value": "2026-10-17T09:00:00"},
+            "tags": {"pact:matcher:type": "type", "min": 2, "value": ["admin"]},
+            "note": null,
+            "address": {
+                "street": {"pact:matcher:type": "include", "value": "Main"},
+                "postcode": {"pact:matcher:type": "equality", "value": "3000"}
+            }
+        }
+        """#
+
+        XCTAssertEqual(try jsonObject(body.json), try jsonObject(expected))
+    }
+
+    func testEscapesStrings() throws {
+        let body = MatchingBody {
+            ("text", "quote \" backslash \\ newline \n tab \t bell \u{07} emoji 🎉")
+        }
+
+        let object = try XCTUnwrap(try jsonObject(body.json) as? [String: String])
+        XCTAssertEqual(object["text"], "quote \" backslash \\ newline \n tab \t bell \u{07} emoji 🎉")
+    }
+
+    func testIdenticalMatcherTreesShareOneBuffer() {
+        func makeBody() -> MatchingBody {
+            MatchingBody {
+                ("id", .integer(1))
+                ("items", .eachLike(.object { ("name", .like("item")) }))
+            }
+        }
+
+        let first = makeBody()
+        let second = makeBody()
+        let different = MatchingBody { ("id", .integer(2)) }
+
+        XCTAssertTrue(first.buffer === second.buffer)
+        XCTAssertFalse(first.buffer === different.buffer)
+    }
+
+    func testBufferCacheDropsLeastRecentlyUsedBuffersAboveByteLimit() {
+        let first: Matcher = .object { ("id", .integer(1)) }
+        let second: Matcher = .object { ("id", .integer(2)) }
+        let third: Matcher = .object { ("id", .integer(3)) }
+        let size = MatchingBody(first).buffer.bytes.count
+        let cache = BufferCache(byteLimit: size * 2)
+
+        let firstBuffer = cache.buffer(for: first)
+        let secondBuffer = cache.buffer(for: second)
+        XCTAssertTrue(firstBuffer === cache.buffer(for: first))
+        _ = cache.buffer(for: third)
+
+        XCTAssertEqual(cache.cachedBytes, size * 2)
+        XCTAssertTrue(firstBuffer === cache.buffer(for: first))
+        XCTAssertFalse(secondBuffer === cache.buffer(for: second))
+    }
+
+    func testMatchingBodyAddsMatchingRulesToPact() throws {
+        let pact = try Pact(consumer: "consumer", provider: "provider").withSpecification(.v4)
+        try Interaction(pactHandle: pact.handle, description: "An interaction")
+            .withRequest(path: "/users")
+            .willRespond(with: TestStatusCode.ok.rawValue) { response in
+                try response.body(MatchingBody { ("id", .integer(1)) })
+            }
+
+        let contents = try XCTUnwrap(String(data: try pact.contents(), encoding: .utf8))
+        XCTAssertTrue(contents.contains(#""$.id""#), contents)
+        XCTAssertTrue(contents.contains(#""match":"integer""#), contents)
+    }
+
+    // MARK: - Benchmarks
+
+    func testPerformance_IntegrationJsonString() {
+        measure(metrics: [XCTClockMetric(), XCTCPUMetric(), XCTMemoryMetric()]) {
+            let pact = Pact(consumer: "consumer", provider: "provider")
+            for index in 0..<100 {
+                let body = #"{"id":{"pact:matcher:type":"integer","value":\#(index % 10)},"# +
+                    #""tags":{"pact:matcher:type":"type","min":1,"value":["admin"]}}"#
+                _ = try? Interaction(pactHandle: pact.handle, description: "An interaction \(index)")
+                    .withRequest(path: "/users")
+                    .willRespond(with: TestStatusCode.ok.rawValue) { response in
+                        try response.body(body, contentType: "application/json")
+                    }
+            }
+        }
+    }
+
+    func testPerformance_MatchingBody() {
+        measure(metrics: [XCTClockMetric(), XCTCPUMetric(), XCTMemoryMetric()]) {
+            let pact = Pact(consumer: "consumer", provider: "provider")
+            for index in 0..<100 {
+                let body = MatchingBody {
+                    ("id", .integer(index % 10))
+                    ("tags", .eachLike("admin"))
+                }
+                _ = try? Interaction(pactHandle: pact.handle, description: "An interaction \(index)")
+                    .withRequest(path: "/users")
+                    .willRespond(with: TestStatusCode.ok.rawValue) { response in
+                        try response.body(body)
+                    }
+            }
+        }
+    }
+}
+
+// MARK: - Private
+
+private extension MatcherTests {
+
+    func jsonObject(_ json: String) throws -> NSObject {
+        try XCTUnwrap(try JSONSerialization.jsonObject(with: Data(json.utf8)) as? NSObject)
+    }
+}
@@ -0,0 +1,204 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class MismatchesDecoderTests: XCTestCase {
+
+    // MARK: - Tests
+
+    func testDecodesEveryFailure() throws {
+        let failures = try decode(Self.payload(count: 3))
+
+        XCTAssertEqual(failures.count, 3)
+        XCTAssertEqual(failures.map(\.path), ["/api/0", "/api/1", "/api/2"])
+        XCTAssertEqual(failures[0].type, .requestMismatch)
+        XCTAssertEqual(failures[0].mismatches.first?.mismatch, #"Expected "a", [got] {b}, \ ]"#)
+        XCTAssertEqual(failures[0].request?.headers?["Content-Type"], "application/json")
+    }
+
+    func testStopsAfterLimit() throws {
+        let failures = try decode(Self.payload(count: 10), limit: 2)
+
+        XCTAssertEqual(failures.map(\.path), ["/api/0", "/api/1"])
+    }
+
+    func testStopsBeforeMalformedElementsPastTheLimit() throws {
+        let json = "[" + Self.failure(index: 0) + ", {not json}]"
+
+        XCTAssertEqual(try decode(json, limit: 1).count, 1)
+        XCTAssertThrowsError(try decode(json))
+    }
+
+    func testDecodesEmptyArray() throws {
+        XCTAssertTrue(try decode(" [ ] ").isEmpty)
+        XCTAssertTrue(try decode("[]").isEmpty)
+    }
+
+    func testThrowsWhenNotAnArray() {
+        XCTAssertThrowsError(try decode(#"{"type":"missing-request"}"#))
+        XCTAssertThrowsError(try decode("[" + Self.failure(index: 0)))
+    }
+
+    func testDecodesSameFailuresAsJSONDecoder() throws {
+        let json = Self.payload(count: 25)
+        let expected = try JSONDecoder().decode([PactVerificationFailure].self, from: Data(json.utf8))
+
+        XCTAssertEqual(try decode(json).map(\.description), expected.map(\.description))
+    }
+
+    func testMockServerDecodesNilMismatchesAsEmpty() throws {
+        let pact = Pact(consumer: "Consumer", provider: "Provider")
+        let mockFFIProvider = MockPactFFIProvider()
+        mockFFIProvider.set(returnNil: true)
+        let server = try MockServer(pact: pact, port: nil, ffiProvider: mockFFIProvider)
+
+        XCTAssertTrue(try server.verificationFailures().isEmpty)
+    }
+
+    // MARK: - Lazy sequence
+
+    func testLazySequenceYieldsEveryFailure() {
+        let failures = PactVerificationFailures(json: Data(Self.payload(count: 3).utf8))
+
+        XCTAssertEqual(failures.map(\.path), ["/api/0", "/api/1", "/api/2"])
+    }
+
+    func testLazySequenceFiltersByType() {
+        let json = "[" + Self.failure(index: 0) + ", " + Self.missingRequest + ", " + Self.failure(index: 1) + "]"
+        let failures = PactVerificationFailures(json: Data(json.utf8))
+
+        XCTAssertEqual(failures.ofType(.missing).map(\.path), ["/api/missing"])
+        XCTAssertEqual(failures.ofType(.requestMismatch).map(\.path), ["/api/0", "/api/1"])
+        XCTAssertTrue(failures.ofType(.requestNotFound).map(\.path).isEmpty)
+    }
+
+    func testLazySequenceYieldsParsingFailuresForMalformedElements() {
+        let json = "[" + Self.failure(index: 0) + ", {not json}, " + Self.failure(index: 1) + "]"
+        let failures = PactVerificationFailures(json: Data(json.utf8))
+
+        XCTAssertEqual(failures.map(\.type), [.requestMismatch, .mockServerParsingFail, .requestMismatch])
+        XCTAssertEqual(failures.map(\.path), ["/api/0", "", "/api/1"])
+        XCTAssertEqual(failures.ofType(.missing).map(\.type), [.mockServerParsingFail])
+    }
+
+    func testLazySequenceEndsWithParsingFailureForMalformedArray() {
+        let json = "[" + Self.failure(index: 0) + ", " + Self.failure(index: 1)
+        let failures = PactVerificationFailures(json: Data(json.utf8))
+
+        XCTAssertEqual(failures.map(\.type), [.requestMismatch, .mockServerParsingFail])
+    }
+
+    func testMockServerLazyFailuresAreEmptyForNilMismatches() throws {
+        let pact = Pact(consumer: "Consumer", provider: "Provider")
+        let mockFFIProvider = MockPactFFIProvider()
+        mockFFIProvider.set(returnNil: true)
+        let server = try MockServer(pact: pact, port: nil, ffiProvider: mockFFIProvider)
+
+        XCTAssertTrue(Array(server.failures).isEmpty)
+    }
+
+    func testMockServerLazyFailuresReadTheMockServerBufferUntilShutdown() async throws {
+        let pact = Pact(consumer: "Consumer", provider: "Provider")
+        let server = try MockServer(pact: pact, port: nil, ffiProvider: MockPactFFIProvider())
+        let failures = server.failures
+
+        // Neither mismatch has the fields of a failure, but their types are skipped without decoding them.
+        XCTAssertEqual(Array(failures).count, 2)
+        XCTAssertTrue(Array(failures.ofType(.missing)).isEmpty)
+
+        await server.shutdown()
+        XCTAssertTrue(Array(failures).isEmpty)
+    }
+
+    func testScannerFindsTopLevelTypeOfElements() throws {
+        var json = #"[{"path": "/type", "request": {"type": "nested"}, "type": "missing-request"}, {"type": 1}, ["type", "x"]]"#
+        let types = try json.withUTF8 { bytes -> [String?] in
+            var scanner = MismatchesDecoder.ElementScanner()
+            var types: [String?] = []
+            while let element = try scanner.next(in: bytes) {
+                types.append(element.type.map { String(decoding: bytes[$0], as: UTF8.self) })
+            }
+            return types
+        }
+
+        XCTAssertEqual(types, ["missing-request", nil, nil])
+    }
+
+    // MARK: - Benchmarks
+
+    func testPerformance_JSONDecoderWithStringCopies() {
+        let json = Self.payload(count: 10_000)
+
+        measure {
+            let string = String(json)
+            _ = try? JSONDecoder().decode([PactVerificationFailure].self, from: string.data(using: .utf8) ?? Data())
+        }
+    }
+
+    func testPerformance_DecodeFromBuffer() {
+        let json = Self.payload(count: 10_000)
+
+        measure {
+            _ = try? decode(json)
+        }
+    }
+
+    func testPerformance_DecodeFromBufferWithLimit() {
+        let json = Self.payload(count: 10_000)
+
+        measure {
+            _ = try? decode(json, limit: 10)
+        }
+    }
+
+    func testPerformance_LazySequenceFirstOfType() {
+        let json = Data((String(Self.payload(count: 10_000).dropLast()) + ", " + Self.missingRequest + "]").utf8)
+
+        measure {
+            _ = PactVerificationFailures(json: json).ofType(.missing).first { _ in true }
+        }
+    }
+}
+
+// MARK: - Private
+
+private extension MismatchesDecoderTests {
+
+    func decode(_ json: String, limit: Int? = nil) throws -> [PactVerificationFailure] {
+        var json = json
+        return try json.withUTF8 { try MismatchesDecoder.decode($0, limit: limit) }
+    }
+
+    static let missingRequest = #"{ "type": "missing-request", "method": "GET", "path": "/api/missing" }"#
+
+    static func payload(count: Int) -> String {
+        "[\n" + (0..<count).map { failure(index: $0) }.joined(separator: ",\n") + "\n]"
+    }
+
+    static func failure(index: Int) -> String {
+        #"""
+        {
+            "type": "request-mismatch",
+            "method": "POST",
+            "path": "/api/\#(index)",
+            "request": { "method": "POST", "path": "/api/\#(index)", "headers": { "Content-Type": "application/json" } },
+            "mismatches": [
+                {
+                    "type": "BodyMismatch",
+                    "expected": [1, 2, 3],
+                    "actual": "{ \"id\": \"\#(index)\" }",
+                    "parameter": "$.id",
+                    "mismatch": "Expected \"a\", [got] {b}, \\ ]"
+                }
+            ]
+        }
+        """#
+    }
+}
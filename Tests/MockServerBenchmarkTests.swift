@@ -0,0 +1,130 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+/// Mock server throughput and latency under concurrent load.
+///
+/// Skipped unless `PACT_BENCHMARK` is set. Tune the run with:
+///
+/// - `PACT_BENCHMARK_CLIENTS`: concurrent clients, defaults to 8.
+/// - `PACT_BENCHMARK_DURATION`: seconds to drive each body kind for, defaults to 5.
+/// - `PACT_BENCHMARK_LOG_FILTER`: `off`, `error`, `warn`, `info`, `debug` or `trace`, defaults to `off`.
+///
+/// The Pact core logger can only be configured once per process, so run this test case on its own and
+/// once per log filter, e.g. `xcodebuild test -only-testing:PactSwiftMockServerTests/MockServerBenchmarkTests`.
+///
+final class MockServerBenchmarkTests: XCTestCase {
+
+    private enum BodyKind: String, CaseIterable {
+        case smallJSON = "small-json"
+        case largeJSON = "large-json"
+        case binary
+    }
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try XCTSkipUnless(environment["PACT_BENCHMARK"] != nil, "Set PACT_BENCHMARK to run mock server benchmarks")
+        try Logging.initialize([Logging.Sink.Config(.buffer, filter: logFilter)])
+    }
+
+    // MARK: - Benchmarks
+
+    func testBenchmark_StandardTransferProtocol() async throws {
+        try await benchmark(.standard)
+    }
+
+    func testBenchmark_SecureTransferProtocol() async throws {
+        #if canImport(Security)
+        try await benchmark(.secure)
+        #else
+        throw XCTSkip("Trusting the TLS mock server needs the Security framework")
+        #endif
+    }
+}
+
+// MARK: - Private
+
+private extension MockServerBenchmarkTests {
+
+    var environment: [String: String] {
+        ProcessInfo.processInfo.environment
+    }
+
+    var clients: Int {
+        environment["PACT_BENCHMARK_CLIENTS"].flatMap(Int.init) ?? 8
+    }
+
+    var duration: TimeInterval {
+        environment["PACT_BENCHMARK_DURATION"].flatMap(TimeInterval.init) ?? 5
+    }
+
+    var logFilter: Logging.Filter {
+        switch environment["PACT_BENCHMARK_LOG_FILTER"]?.lowercased() {
+        case "error": return .error
+        case "warn": return .warn
+        case "info": return .info
+        case "debug": return .debug
+        case "trace": return .trace
+        default: return .off
+        }
+    }
+
+    func benchmark(_ transferProtocol: MockServer.TransferProtocol) async throws {
+        let pact = Pact(consumer: "benchmark-consumer", provider: "benchmark-provider")
+        for kind in BodyKind.allCases {
+            let (body, contentType) = try self.body(for: kind)
+            try pact
+                .uponReceiving("a request for a \(kind.rawValue) body")
+                .withRequest(path: "/\(kind.rawValue)")
+                .willRespond(with: 200) { response in
+                    try response.body(body, contentType: contentType)
+                }
+        }
+
+        let server = try await MockServer.start(pact: pact, transferProtocol: transferProtocol)
+
+        for kind in BodyKind.allCases {
+            let report = await LoadGenerator.run(
+                label: "\(transferProtocol.protocol) \(kind.rawValue) log=\(environment["PACT_BENCHMARK_LOG_FILTER"] ?? "off")",
+                request: URLRequest(url: server.baseUrl.appendingPathComponent(kind.rawValue)),
+                session: session(for: server),
+                clients: clients,
+                duration: duration
+            )
+            #if canImport(Darwin)
+            add(XCTAttachment(string: report.description))
+            #endif
+            XCTAssertEqual(report.errors, 0, report.description)
+        }
+
+        await server.shutdown()
+    }
+
+    func session(for server: MockServer) -> URLSession {
+        #if canImport(Security)
+        return server.urlSession
+        #else
+        return URLSession(configuration: .ephemeral)
+        #endif
+    }
+
+    func body(for kind: BodyKind) throws -> (Data, String) {
+        switch kind {
+        case .smallJSON:
+            return (Data(#"{"id":1,"name":"small"}"#.utf8), "application/json")
+        case .largeJSON:
+            let items = (0..<5_000).map { #"{"id":\#($0),"name":"item \#($0)","tags":["a","b","c"]}"# }
+            return (Data(("[" + items.joined(separator: ",") + "]").utf8), "application/json")
+        case .binary:
+            let path = try XCTUnwrap(Bundle(for: Self.self).path(forResource: "test_image", ofType: "jpg"))
+            return (try Data(contentsOf: URL(fileURLWithPath: path)), "image/jpeg")
+        }
+    }
+}
@@ -0,0 +1,158 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class MockServerPoolTests: XCTestCase {
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try Logging.initialize()
+    }
+
+    // MARK: - Tests
+
+    func testStartsOneServerForContractRequestedOnce() throws {
+        let started = Counter()
+        let pool = MockServerPool(capacity: 8) { pact, transferProtocol in
+            started.increment()
+            return try MockServer(pact: pact, transferProtocol: transferProtocol)
+        }
+
+        _ = try pool.mockServer(for: try makePact(path: "/events"))
+        pool.waitForSpares()
+
+        XCTAssertEqual(started.value, 1)
+        XCTAssertEqual(pool.residentCount, 0)
+        XCTAssertEqual(pool.misses, 1)
+    }
+
+    func testHandsOutSpareOnceContractIsRequestedAgain() throws {
+        let pool = MockServerPool()
+
+        let first = try pool.mockServer(for: try makePact(path: "/events"))
+        let second = try pool.mockServer(for: try makePact(path: "/events"))
+        pool.waitForSpares()
+        XCTAssertEqual(pool.residentCount, 1)
+
+        let pact = try makePact(path: "/events")
+        let third = try pool.mockServer(for: pact)
+
+        XCTAssertFalse(first === second)
+        XCTAssertFalse(second === third)
+        XCTAssertNotEqual(second.port, third.port)
+        XCTAssertTrue(pact.hasStartedMockServer)
+        XCTAssertEqual(pool.hits, 1)
+        XCTAssertEqual(pool.misses, 2)
+    }
+
+    func testNeverHandsOutServerThatServedRequests() async throws {
+        let pool = MockServerPool()
+
+        _ = try pool.mockServer(for: try makePact(path: "/events"))
+        let first = try pool.mockServer(for: try makePact(path: "/events"))
+        _ = try await URLSession(configuration: .ephemeral).data(from: first.baseUrl.appendingPathComponent("events"))
+        XCTAssertTrue(first.requestsMatched)
+        pool.waitForSpares()
+
+        let second = try pool.mockServer(for: try makePact(path: "/events"))
+
+        XCTAssertFalse(first === second)
+        XCTAssertFalse(second.requestsMatched)
+        XCTAssertEqual(pool.hits, 1)
+    }
+
+    func testStartsNewServerForDifferentInteractions() throws {
+        let pool = MockServerPool()
+
+        let first = try pool.mockServer(for: try makePact(path: "/events"))
+        let second = try pool.mockServer(for: try makePact(path: "/users"))
+        pool.waitForSpares()
+
+        XCTAssertFalse(first === second)
+        XCTAssertNotEqual(first.port, second.port)
+        XCTAssertEqual(pool.hits, 0)
+        XCTAssertEqual(pool.misses, 2)
+        XCTAssertEqual(pool.residentCount, 0)
+    }
+
+    func testStartsNewServerForDifferentTransferProtocol() throws {
+        let pool = MockServerPool()
+
+        for transferProtocol in [MockServer.TransferProtocol.standard, .secure, .standard, .secure] {
+            _ = try pool.mockServer(for: try makePact(path: "/events"), transferProtocol: transferProtocol)
+        }
+        pool.waitForSpares()
+
+        XCTAssertEqual(pool.misses, 4)
+        XCTAssertEqual(pool.residentCount, 2)
+    }
+
+    func testEvictsLeastRecentlyUsedContract() throws {
+        let pool = MockServerPool(capacity: 2)
+
+        for path in ["/events", "/users", "/orders"] {
+            _ = try pool.mockServer(for: try makePact(path: path))
+            _ = try pool.mockServer(for: try makePact(path: path))
+            pool.waitForSpares()
+        }
+        XCTAssertEqual(pool.residentCount, 2)
+
+        _ = try pool.mockServer(for: try makePact(path: "/users"))
+        _ = try pool.mockServer(for: try makePact(path: "/events"))
+
+        XCTAssertEqual(pool.hits, 1)
+        XCTAssertEqual(pool.misses, 7)
+    }
+
+    func testDrainResetsPool() throws {
+        let pool = MockServerPool()
+        _ = try pool.mockServer(for: try makePact(path: "/events"))
+        _ = try pool.mockServer(for: try makePact(path: "/events"))
+
+        pool.drain()
+
+        XCTAssertEqual(pool.residentCount, 0)
+        XCTAssertEqual(pool.hits, 0)
+        XCTAssertEqual(pool.misses, 0)
+    }
+
+    func testContractFingerprintIgnoresPactIdentity() throws {
+        XCTAssertEqual(try makePact(path: "/events").contractFingerprint, try makePact(path: "/events").contractFingerprint)
+        XCTAssertNotEqual(try makePact(path: "/events").contractFingerprint, try makePact(path: "/users").contractFingerprint)
+    }
+}
+
+// MARK: - Private
+
+private extension MockServerPoolTests {
+
+    func makePact(path: String) throws -> Pact {
+        try PactFixtures.pact(consumer: "pool-consumer", provider: "pool-provider", paths: [path])
+    }
+}
+
+private final class Counter: @unchecked Sendable {
+    private let lock = NSLock()
+    private var count = 0
+
+    var value: Int {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return count
+    }
+
+    func increment() {
+        lock.lock()
+        defer { lock.unlock() }
+
+        count += 1
+    }
+}
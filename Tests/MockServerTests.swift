@@ -13,7 +13,7 @@ final class MockServerTests: XCTestCase {
 
     override func setUp() async throws {
         try await super.setUp()
-        try await Logging.initialize()
+        try Logging.initialize()
     }
 
     // MARK: - Tests
@@ -83,3 +83,134 @@ final class MockServerTests: XCTestCase {
         XCTAssertEqual(server.logs, "ERROR: Unable to retrieve mock server logs")
     }
 }
+
+// MARK: - Async lifecycle
+
+extension MockServerTests {
+
+    func testMockServer_StartsAsync() async throws {
+        let pact = Pact(consumer: "Consumer", provider: "Provider")
+        let server = try await MockServer.start(pact: pact, transferProtocol: .standard)
+        XCTAssertGreaterThan(server.port, 0)
+
+        await server.shutdown()
+    }
+
+    func testMockServer_LetsTheOSPickThePort() throws {
+        let mockFFIProvider = MockPactFFIProvider()
+        let pact = Pact(consumer: "Consumer", provider: "Provider")
+
+        _ = try MockServer(pact: pact, port: nil, ffiProvider: mockFFIProvider)
+        _ = try MockServer(pact: pact, port: 4_321, ffiProvider: mockFFIProvider)
+
+        XCTAssertEqual(mockFFIProvider.requestedPorts, [0, 4_321])
+    }
+
+    func testMockServer_ShutsDownOnce() async throws {
+        let mockFFIProvider = MockPactFFIProvider()
+        let pact = Pact(consumer: "Consumer", provider: "Provider")
+        let server = try await MockServer.start(pact: pact, ffiProvider: mockFFIProvider)
+
+        await server.shutdown()
+        XCTAssertEqual(mockFFIProvider.cleanupCallCount, 1)
+
+        // Subsequent calls do nothing
+        await server.shutdown()
+        XCTAssertEqual(mockFFIProvider.cleanupCallCount, 1)
+    }
+
+    func testMockServer_ShutsDownServersConcurrently() async throws {
+        let mockFFIProvider = MockPactFFIProvider()
+        let pact = Pact(consumer: "Consumer", provider: "Provider")
+
+        var servers: [MockServer] = []
+        for _ in 0..<8 {
+            servers.append(try await MockServer.start(pact: pact, ffiProvider: mockFFIProvider))
+        }
+
+        await MockServer.shutdown(servers)
+        XCTAssertEqual(mockFFIProvider.cleanupCallCount, 8)
+    }
+}
+
+// MARK: - Quiescence
+
+extension MockServerTests {
+
+    func testMockServer_BecomesQuiescentWithoutActivity() async throws {
+        let pact = Pact(consumer: "Consumer", provider: "Provider")
+        let server = try MockServer(pact: pact, port: nil, ffiProvider: MockPactFFIProvider())
+
+        let quiescent = await server.awaitQuiescence(MockServer.Quiescence(idleWindow: 0.05, timeout: 1))
+        XCTAssertTrue(quiescent)
+    }
+
+    func testMockServer_QuiescenceTimesOut() async throws {
+        let pact = Pact(consumer: "Consumer", provider: "Provider")
+        let server = try MockServer(pact: pact, port: nil, ffiProvider: MockPactFFIProvider())
+
+        let quiescent = await server.awaitQuiescence(MockServer.Quiescence(idleWindow: 1, timeout: 0.05))
+        XCTAssertFalse(quiescent)
+    }
+}
+
+// MARK: - TLS
+
+extension MockServerTests {
+
+    func testMockServer_FetchesTLSCertOnce() throws {
+        let pact = Pact(consumer: "Consumer", provider: "Provider")
+        let mockFFIProvider = MockPactFFIProvider()
+        let authority = TLSCertificateAuthority(ffiProvider: mockFFIProvider)
+        let servers = try (0..<3).map { _ in
+            try MockServer(
+                pact: pact,
+                transferProtocol: .secure,
+                port: nil,
+                ffiProvider: mockFFIProvider,
+                certificateAuthority: authority
+            )
+        }
+
+        XCTAssertEqual(servers.compactMap(\.tlsCACertificate), Array(repeating: "mock-tls-ca-cert", count: 3))
+        XCTAssertEqual(mockFFIProvider.tlsCACertificateCallCount, 1)
+    }
+
+    #if canImport(Security)
+    func testMockServer_SharesURLSession() throws {
+        let first = try MockServer(pact: Pact(consumer: "Consumer", provider: "Provider"), transferProtocol: .secure)
+        let second = try MockServer(pact: Pact(consumer: "Consumer", provider: "Provider"), transferProtocol: .secure)
+
+        XCTAssertTrue(first.urlSession === second.urlSession)
+    }
+
+    func testMockServer_URLSessionTrustsTLSMockServer() async throws {
+        let pact = Pact(consumer: "Consumer", provider: "Provider")
+        try pact
+            .uponReceiving("a request over TLS")
+            .withRequest(path: "/secure")
+            .willRespond(with: 200)
+        let server = try MockServer(pact: pact, transferProtocol: .secure)
+
+        let (_, response) = try await server.urlSession.data(from: server.baseUrl.appendingPathComponent("secure"))
+
+        XCTAssertEqual((response as? HTTPURLResponse)?.statusCode, 200)
+        XCTAssertTrue(server.requestsMatched)
+    }
+    #endif
+
+    func testTLSCertificateAuthority_DecodesFirstPEMCertificate() throws {
+        let der = Data((0..<64).map { UInt8($0) })
+        let pem = """
+        -----BEGIN CERTIFICATE-----
+        \(der.base64EncodedString(options: .lineLength64Characters))
+        -----END CERTIFICATE-----
+        -----BEGIN CERTIFICATE-----
+        AAAA
+        -----END CERTIFICATE-----
+        """
+
+        XCTAssertEqual(TLSCertificateAuthority.der(fromPEM: pem), der)
+        XCTAssertNil(TLSCertificateAuthority.der(fromPEM: "mock-tls-ca-cert"))
+    }
+}
@@ -22,7 +22,7 @@ final class PactBuilderTests: XCTestCase {
 
     override func setUp() async throws {
         try await super.setUp()
-        try await Logging.initialize(
+        try Logging.initialize(
             [
                 Logging.Sink.Config(.standardOut, filter: .debug),
                 Logging.Sink.Config(.standardError, filter: .debug),
@@ -441,6 +441,206 @@ final class PactBuilderTests: XCTestCase {
             XCTAssertEqual(fileData, responseData)
         }
     }
+
+    func testInteractionWithFileBodyInRequest() async throws {
+        let fileURL = try XCTUnwrap(Bundle(for: Self.self).url(forResource: "test_image", withExtension: "jpg"))
+        let fileData = try Data(contentsOf: fileURL)
+
+        try builder
+            .uponReceiving("A request with a file body")
+            .given(
+                "Some state expecting a file body",
+                withName: #function,
+                value: String(describing: #line)
+            )
+            .withRequest(method: .POST, path: "/uploads") { context in
+                try context.body(fileURL: fileURL, contentType: "application/octet-stream")
+            }
+            .willRespond(with: 201)
+
+        try await builder.verify { context in
+            let urlRequest = try context.buildURLRequest(path: "/uploads", body: fileData)
+            let (_, response) = try await URLSession(configuration: .ephemeral).data(for: urlRequest)
+
+            let httpResponse = try XCTUnwrap(response as? HTTPURLResponse)
+            XCTAssertEqual(httpResponse.statusCode, 201)
+        }
+    }
+
+    func testInteractionWithFileBodyInResponse() async throws {
+        let fileURL = try XCTUnwrap(Bundle(for: Self.self).url(forResource: "test_image", withExtension: "jpg"))
+        let fileData = try Data(contentsOf: fileURL)
+
+        try builder
+            .uponReceiving("A request for a file body")
+            .given(
+                "Some state expecting a file body",
+                withName: #function,
+                value: String(describing: #line)
+            )
+            .withRequest(method: .GET, path: "/uploads/0")
+            .willRespond(with: 200) { context in
+                try context.body(fileURL: fileURL, contentType: "image/jpeg")
+            }
+
+        try await builder.verify { context in
+            let url = try context.buildRequestURL(path: "/uploads/0")
+            let (responseData, response) = try await URLSession(configuration: .ephemeral).data(from: url)
+
+            let httpResponse = try XCTUnwrap(response as? HTTPURLResponse)
+            XCTAssertEqual(httpResponse.statusCode, 200)
+            XCTAssertEqual(httpResponse.value(forHTTPHeaderField: "Content-Type"), "image/jpeg")
+            XCTAssertEqual(fileData, responseData)
+        }
+    }
+
+    func testInteractionWithMultipartFileInRequest() async throws {
+        let fileURL = try XCTUnwrap(Bundle(for: Self.self).url(forResource: "test_image", withExtension: "jpg"))
+        let fileData = try Data(contentsOf: fileURL)
+        let boundary = "pact-swift-boundary"
+
+        try builder
+            .uponReceiving("A multipart request with a file")
+            .given(
+                "Some state expecting a multipart upload",
+                withName: #function,
+                value: String(describing: #line)
+            )
+            .withRequest(method: .POST, path: "/uploads") { context in
+                try context.multipart(part: "file", file: fileURL, contentType: "image/jpeg", boundary: boundary)
+            }
+            .willRespond(with: 201)
+
+        try await builder.verify { context in
+            var body = Data("--\(boundary)\r\n".utf8)
+            body.append(Data("Content-Disposition: form-data; name=\"file\"; filename=\"test_image.jpg\"\r\n".utf8))
+            body.append(Data("Content-Type: image/jpeg\r\n\r\n".utf8))
+            body.append(fileData)
+            body.append(Data("\r\n--\(boundary)--\r\n".utf8))
+
+            var urlRequest = try context.buildURLRequest(path: "/uploads", body: body)
+            urlRequest.setValue("multipart/form-data; boundary=\(boundary)", forHTTPHeaderField: "Content-Type")
+            let (_, response) = try await URLSession(configuration: .ephemeral).data(for: urlRequest)
+
+            let httpResponse = try XCTUnwrap(response as? HTTPURLResponse)
+            XCTAssertEqual(httpResponse.statusCode, 201)
+        }
+    }
+
+    func testMultipartThrowsForMissingFile() throws {
+        let missingURL = URL(fileURLWithPath: NSTemporaryDirectory()).appendingPathComponent("\(UUID().uuidString).jpg")
+
+        XCTAssertThrowsError(
+            try builder
+                .uponReceiving("A multipart request with a missing file")
+                .withRequest(method: .POST, path: "/uploads") { context in
+                    try context.multipart(part: "file", file: missingURL, contentType: "image/jpeg")
+                }
+        )
+    }
+
+    func testFileBodyThrowsForMissingFile() throws {
+        let missingURL = URL(fileURLWithPath: NSTemporaryDirectory()).appendingPathComponent("\(UUID().uuidString).jpg")
+
+        XCTAssertThrowsError(
+            try builder
+                .uponReceiving("A request with a missing file body")
+                .withRequest(method: .POST, path: "/uploads") { context in
+                    try context.body(fileURL: missingURL, contentType: "image/jpeg")
+                }
+        )
+    }
+
+    // MARK: - Per-test mock servers
+
+    func testPerTestMockServerVerifiesOnlyTheTestsInteractions() async throws {
+        let pact = try Pact(consumer: consumer, provider: "\(provider)_per_test").withSpecification(.v4)
+        let testBuilder = PactBuilder(pact: pact, config: PactBuilder.Config(pactDirectory: pactDirectory))
+
+        try testBuilder
+            .uponReceiving("A request for events", testName: "testEvents")
+            .withRequest(method: .GET, path: "/events")
+            .willRespond(with: 200)
+
+        try testBuilder
+            .uponReceiving("A request for users", testName: "testUsers")
+            .withRequest(method: .GET, path: "/users")
+            .willRespond(with: 200)
+
+        try testBuilder.startMockServer()
+
+        try await testBuilder.verify(testName: "testEvents") { context in
+            let url = try context.buildRequestURL(path: "/events")
+            let (_, response) = try await URLSession(configuration: .ephemeral).data(from: url)
+
+            let httpResponse = try XCTUnwrap(response as? HTTPURLResponse)
+            XCTAssertEqual(httpResponse.statusCode, 200)
+        }
+
+        do {
+            try testBuilder.verify(testName: "testUsers") { _ in }
+            XCTFail("Expected a missing request for /users")
+        } catch PactBuilder.Error.pactFailure(let failures) {
+            XCTAssertEqual(failures.count, 1)
+            XCTAssertEqual(failures.first?.type, .missing)
+            XCTAssertEqual(failures.first?.path, "/users")
+        }
+
+        try testBuilder.stopMockServer()
+    }
+
+    func testPerTestMockServerDoesNotSwapFailuresOnTheSameRoute() async throws {
+        let pact = try Pact(consumer: consumer, provider: "\(provider)_per_test_route").withSpecification(.v4)
+        let testBuilder = PactBuilder(pact: pact, config: PactBuilder.Config(pactDirectory: pactDirectory))
+
+        for role in ["admin", "guest"] {
+            try testBuilder
+                .uponReceiving("A request for users as \(role)", testName: "test\(role)")
+                .withRequest(method: .GET, path: "/users") { request in
+                    try request.header("X-Role", value: role)
+                }
+                .willRespond(with: 200)
+        }
+
+        try testBuilder.startMockServer()
+
+        // The admin test sends the guest's request, which only the guest test expects
+        do {
+            try await testBuilder.verify(testName: "testadmin") { context in
+                var request = URLRequest(url: try context.buildRequestURL(path: "/users"))
+                request.setValue("guest", forHTTPHeaderField: "X-Role")
+                _ = try await URLSession(configuration: .ephemeral).data(for: request)
+            }
+            XCTFail("Expected the admin test to fail")
+        } catch PactBuilder.Error.pactFailure(let failures) {
+            XCTAssertFalse(failures.isEmpty)
+        }
+
+        try await testBuilder.verify(testName: "testguest") { context in
+            var request = URLRequest(url: try context.buildRequestURL(path: "/users"))
+            request.setValue("guest", forHTTPHeaderField: "X-Role")
+            _ = try await URLSession(configuration: .ephemeral).data(for: request)
+        }
+
+        try testBuilder.stopMockServer()
+    }
+
+    func testVerifyByTestNameStartsTheMockServerOnDemand() throws {
+        let pact = try Pact(consumer: consumer, provider: "\(provider)_on_demand").withSpecification(.v4)
+        let testBuilder = PactBuilder(pact: pact, config: PactBuilder.Config(pactDirectory: pactDirectory))
+
+        try testBuilder
+            .uponReceiving("A request for events", testName: "testEvents")
+            .withRequest(method: .GET, path: "/events")
+            .willRespond(with: 200)
+
+        XCTAssertThrowsError(try testBuilder.verify(testName: "testEvents") { _ in }) { error in
+            guard case .pactFailure(let failures)? = error as? PactBuilder.Error else {
+                return XCTFail("Expected a pact failure, got \(error)")
+            }
+            XCTAssertEqual(failures.first?.type, .missing)
+        }
+    }
 }
 
 // MARK: - Private
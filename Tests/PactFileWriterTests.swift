@@ -0,0 +1,127 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class PactFileWriterTests: XCTestCase {
+
+    private var pactDirectory: URL!
+
+    private var fileURL: URL {
+        pactDirectory.appendingPathComponent("writer-consumer-writer-provider.json")
+    }
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try Logging.initialize()
+
+        pactDirectory = FileManager.default.temporaryDirectory.appendingPathComponent("pacts-\(UUID().uuidString)", isDirectory: true)
+    }
+
+    override func tearDown() async throws {
+        try? FileManager.default.removeItem(at: pactDirectory)
+        try await super.tearDown()
+    }
+
+    // MARK: - Tests
+
+    func testBatchesWritesToTheSameFile() throws {
+        let writer = PactFileWriter(debounce: 60)
+        let pact = try makePact(paths: ["/events"])
+
+        for _ in 0..<3 {
+            writer.write(pact, directory: pactDirectory.path)
+        }
+        XCTAssertFalse(FileManager.default.fileExists(atPath: fileURL.path))
+
+        try writer.flush()
+
+        let size = try XCTUnwrap(try FileManager.default.attributesOfItem(atPath: fileURL.path)[.size] as? NSNumber)
+        XCTAssertEqual(writer.statistics.requests, 3)
+        XCTAssertEqual(writer.statistics.fileWrites, 1)
+        XCTAssertEqual(writer.statistics.merges, 1)
+        XCTAssertEqual(writer.statistics.bytesWritten, size.intValue)
+        XCTAssertGreaterThan(writer.statistics.mergeDuration, 0)
+        XCTAssertEqual(try FileManager.default.contentsOfDirectory(atPath: pactDirectory.path), [fileURL.lastPathComponent])
+    }
+
+    func testMergesPactsIntoExistingFile() throws {
+        let writer = PactFileWriter(debounce: 60)
+
+        writer.write(try makePact(paths: ["/events"]), directory: pactDirectory.path)
+        try writer.flush()
+        writer.write(try makePact(paths: ["/users"]), directory: pactDirectory.path)
+        writer.write(try makePact(paths: ["/orders"]), directory: pactDirectory.path)
+        try writer.flush()
+
+        let json = try XCTUnwrap(try JSONSerialization.jsonObject(with: Data(contentsOf: fileURL)) as? [String: Any])
+        XCTAssertEqual((json["interactions"] as? [Any])?.count, 3)
+        XCTAssertEqual(writer.statistics.fileWrites, 2)
+        XCTAssertEqual(writer.statistics.merges, 3)
+    }
+
+    func testWritesAfterDebounce() throws {
+        let writer = PactFileWriter(debounce: 0.05)
+
+        writer.write(try makePact(paths: ["/events"]), directory: pactDirectory.path)
+
+        let written = expectation(for: NSPredicate { _, _ in writer.statistics.fileWrites == 1 }, evaluatedWith: nil)
+        wait(for: [written], timeout: 5)
+        XCTAssertTrue(FileManager.default.fileExists(atPath: fileURL.path))
+    }
+
+    func testBuilderHandsPactFileToWriter() async throws {
+        let writer = PactFileWriter(debounce: 60)
+        let pact = try makePact(paths: ["/events"])
+        let builder = PactBuilder(pact: pact, config: PactBuilder.Config(pactDirectory: pactDirectory.path, pactFileWriter: writer))
+
+        try await builder.verify { context in
+            _ = try await URLSession(configuration: .ephemeral).data(from: context.mockServerURL.appendingPathComponent("events"))
+        }
+        XCTAssertFalse(FileManager.default.fileExists(atPath: fileURL.path))
+
+        try writer.flush()
+        XCTAssertTrue(FileManager.default.fileExists(atPath: fileURL.path))
+    }
+
+    func testRecordsFailedWritesUntilFlushed() throws {
+        let writer = PactFileWriter(debounce: 0.05)
+        // A file where the Pact directory should be
+        try Data().write(to: pactDirectory)
+
+        writer.write(try makePact(paths: ["/events"]), directory: pactDirectory.path)
+
+        let failed = expectation(for: NSPredicate { _, _ in writer.errors.isEmpty == false }, evaluatedWith: nil)
+        wait(for: [failed], timeout: 5)
+        XCTAssertThrowsError(try writer.flush())
+        XCTAssertTrue(writer.errors.isEmpty)
+    }
+
+    func testStoppingMockServersFlushesWriter() throws {
+        let writer = PactFileWriter(debounce: 60)
+        let pact = try makePact(paths: [])
+        let builder = PactBuilder(pact: pact, config: PactBuilder.Config(pactDirectory: pactDirectory.path, pactFileWriter: writer))
+        writer.write(try makePact(paths: ["/events"]), directory: pactDirectory.path)
+
+        try builder.startMockServer()
+        try builder.stopMockServer()
+
+        XCTAssertTrue(FileManager.default.fileExists(atPath: fileURL.path))
+        XCTAssertEqual(writer.statistics.fileWrites, 1)
+    }
+}
+
+// MARK: - Private
+
+private extension PactFileWriterTests {
+
+    func makePact(paths: [String]) throws -> Pact {
+        try PactFixtures.pact(consumer: "writer-consumer", provider: "writer-provider", paths: paths)
+    }
+}
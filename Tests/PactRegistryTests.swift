@@ -0,0 +1,131 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class PactRegistryTests: XCTestCase {
+
+    private var pactDirectory: URL!
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try Logging.initialize()
+
+        pactDirectory = FileManager.default.temporaryDirectory.appendingPathComponent("pacts-\(UUID().uuidString)", isDirectory: true)
+    }
+
+    override func tearDown() async throws {
+        try? FileManager.default.removeItem(at: pactDirectory)
+        try await super.tearDown()
+    }
+
+    // MARK: - Tests
+
+    func testReturnsOnePactPerConsumerProviderPair() throws {
+        let registry = PactRegistry()
+
+        let pact = try registry.pact(consumer: "registry-consumer", provider: "registry-provider", specification: .v3)
+
+        XCTAssertTrue(pact === (try registry.pact(consumer: "registry-consumer", provider: "registry-provider")))
+        XCTAssertFalse(pact === (try registry.pact(consumer: "registry-consumer", provider: "other-provider")))
+        XCTAssertTrue(pact.registry === registry)
+        XCTAssertEqual(pact.specVersion, .v3)
+    }
+
+    func testBuildersShareOnePactAndWriteItOnce() async throws {
+        let registry = PactRegistry()
+        let eventsBuilder = try makeBuilder(registry: registry, path: "/events")
+        let usersBuilder = try makeBuilder(registry: registry, path: "/users")
+
+        try await eventsBuilder.verify { context in
+            _ = try await URLSession(configuration: .ephemeral).data(from: context.mockServerURL.appendingPathComponent("events"))
+        }
+        try await usersBuilder.verify { context in
+            _ = try await URLSession(configuration: .ephemeral).data(from: context.mockServerURL.appendingPathComponent("users"))
+        }
+
+        let fileURL = pactDirectory.appendingPathComponent("registry-consumer-registry-provider.json")
+        XCTAssertFalse(FileManager.default.fileExists(atPath: fileURL.path))
+
+        try registry.writePactFiles()
+
+        let json = try XCTUnwrap(try JSONSerialization.jsonObject(with: Data(contentsOf: fileURL)) as? [String: Any])
+        XCTAssertEqual((json["interactions"] as? [Any])?.count, 2)
+
+        // Nothing was verified since, so the file isn't written again.
+        try FileManager.default.removeItem(at: fileURL)
+        try registry.writePactFiles()
+        XCTAssertFalse(FileManager.default.fileExists(atPath: fileURL.path))
+    }
+
+    func testRefusesPactOnceMockServerStartedUntilWritten() async throws {
+        let registry = PactRegistry()
+        let eventsBuilder = try makeBuilder(registry: registry, path: "/events")
+
+        try await eventsBuilder.verify { context in
+            _ = try await URLSession(configuration: .ephemeral).data(from: context.mockServerURL.appendingPathComponent("events"))
+        }
+
+        XCTAssertThrowsError(try makeBuilder(registry: registry, path: "/users")) { error in
+            guard case .canNotBeModified? = error as? Pact.Error else {
+                return XCTFail("Expected Pact.Error.canNotBeModified, got \(error)")
+            }
+        }
+
+        try registry.writePactFiles()
+        let usersBuilder = try makeBuilder(registry: registry, path: "/users")
+        try await usersBuilder.verify { context in
+            _ = try await URLSession(configuration: .ephemeral).data(from: context.mockServerURL.appendingPathComponent("users"))
+        }
+        try registry.writePactFiles()
+
+        let fileURL = pactDirectory.appendingPathComponent("registry-consumer-registry-provider.json")
+        let json = try XCTUnwrap(try JSONSerialization.jsonObject(with: Data(contentsOf: fileURL)) as? [String: Any])
+        let descriptions = (json["interactions"] as? [[String: Any]])?.compactMap { $0["description"] as? String }
+        XCTAssertEqual(descriptions?.sorted(), ["A request for /events", "A request for /users"])
+    }
+
+    func testDoesNotWritePactWithFailedVerification() async throws {
+        let registry = PactRegistry()
+        let builder = try makeBuilder(registry: registry, path: "/events")
+
+        do {
+            try await builder.verify { _ in }
+            XCTFail("Expected the missing request to fail verification")
+        } catch PactBuilder.Error.pactFailure(let failures) {
+            XCTAssertEqual(failures.map(\.path), ["/events"])
+        }
+
+        try registry.writePactFiles()
+
+        let fileURL = pactDirectory.appendingPathComponent("registry-consumer-registry-provider.json")
+        XCTAssertFalse(FileManager.default.fileExists(atPath: fileURL.path))
+
+        // The failure is cleared once the Pact files are written.
+        let retried = try makeBuilder(registry: registry, path: "/events")
+        try await retried.verify { context in
+            _ = try await URLSession(configuration: .ephemeral).data(from: context.mockServerURL.appendingPathComponent("events"))
+        }
+        try registry.writePactFiles()
+        XCTAssertTrue(FileManager.default.fileExists(atPath: fileURL.path))
+    }
+}
+
+// MARK: - Private
+
+private extension PactRegistryTests {
+
+    func makeBuilder(registry: PactRegistry, path: String) throws -> PactBuilder {
+        let pact = try registry.pact(consumer: "registry-consumer", provider: "registry-provider")
+        let builder = PactBuilder(pact: pact, config: PactBuilder.Config(pactDirectory: pactDirectory.path))
+        try PactFixtures.addInteractions(paths: [path]) { builder.uponReceiving($0) }
+
+        return builder
+    }
+}
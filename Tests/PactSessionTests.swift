@@ -0,0 +1,112 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class PactSessionTests: XCTestCase {
+
+    private var pactDirectory: URL!
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try Logging.initialize()
+
+        pactDirectory = FileManager.default.temporaryDirectory.appendingPathComponent("pacts-\(UUID().uuidString)", isDirectory: true)
+    }
+
+    override func tearDown() async throws {
+        try? FileManager.default.removeItem(at: pactDirectory)
+        try await super.tearDown()
+    }
+
+    // MARK: - Tests
+
+    func testRunsOnItsOwnExecutor() async throws {
+        let session = try makeSession(provider: "session-provider")
+
+        XCTAssertFalse(session.isOnExecutor)
+        let isOnExecutor = try await session.withBuilder { _ in session.isOnExecutor }
+        XCTAssertTrue(isOnExecutor)
+    }
+
+    func testBuildsInteractionsOnManySessionsConcurrently() async throws {
+        let sessions = try (0..<8).map { try makeSession(provider: "session-provider-\($0)") }
+        let template = InteractionTemplate("A request for item {{id}}", spec: InteractionSpec(path: "/items/{{id}}", status: TestStatusCode.ok.rawValue))
+
+        try await withThrowingTaskGroup(of: Void.self) { group in
+            for session in sessions {
+                for id in 0..<25 {
+                    group.addTask { try await session.addInteraction(template, parameters: ["id": "\(id)"]) }
+                }
+            }
+            try await group.waitForAll()
+        }
+
+        for session in sessions {
+            try await session.writePactFile(directory: pactDirectory.path, overwrite: true)
+            XCTAssertEqual(try interactionDescriptions(consumer: session.consumer, provider: session.provider).count, 25)
+        }
+    }
+
+    func testKeepsWorkOnOneSessionOrdered() async throws {
+        let session = try makeSession(provider: "session-provider")
+
+        for id in 0..<10 {
+            try await session.addInteraction("A request for item \(id)", spec: InteractionSpec(path: "/items/\(id)", status: TestStatusCode.ok.rawValue))
+        }
+        try await session.writePactFile(directory: pactDirectory.path, overwrite: true)
+
+        XCTAssertEqual(try interactionDescriptions(consumer: session.consumer, provider: session.provider), (0..<10).map { "A request for item \($0)" })
+    }
+
+    func testVerifiesInteractions() async throws {
+        let session = try makeSession(provider: "session-provider")
+        try await session.addInteraction("A request for events", spec: InteractionSpec(path: "/events", status: TestStatusCode.ok.rawValue))
+
+        try await session.verify { context in
+            let (_, response) = try await URLSession(configuration: .ephemeral).data(from: context.mockServerURL.appendingPathComponent("events"))
+            XCTAssertEqual((response as? HTTPURLResponse)?.statusCode, TestStatusCode.ok.rawValue)
+        }
+    }
+
+    func testRejectsChangesWhileVerifying() async throws {
+        let session = try makeSession(provider: "session-provider")
+        try await session.addInteraction("A request for events", spec: InteractionSpec(path: "/events", status: TestStatusCode.ok.rawValue))
+
+        try await session.verify { context in
+            do {
+                try await session.addInteraction("A request for users", spec: InteractionSpec(path: "/users", status: TestStatusCode.ok.rawValue))
+                XCTFail("Expected the interaction to be rejected")
+            } catch {
+                guard case .canNotBeModified? = error as? Pact.Error else {
+                    return XCTFail("Unexpected error: \(error)")
+                }
+            }
+            _ = try await URLSession(configuration: .ephemeral).data(from: context.mockServerURL.appendingPathComponent("events"))
+        }
+
+        XCTAssertEqual(try interactionDescriptions(consumer: session.consumer, provider: session.provider), ["A request for events"])
+    }
+}
+
+// MARK: - Private
+
+private extension PactSessionTests {
+
+    func makeSession(provider: String) throws -> PactSession {
+        try PactSession(consumer: "session-consumer", provider: provider, config: PactBuilder.Config(pactDirectory: pactDirectory.path))
+    }
+
+    func interactionDescriptions(consumer: String, provider: String) throws -> [String] {
+        let data = try Data(contentsOf: pactDirectory.appendingPathComponent("\(consumer)-\(provider).json"))
+        let json = try XCTUnwrap(try JSONSerialization.jsonObject(with: data) as? [String: Any])
+        let interactions = try XCTUnwrap(json["interactions"] as? [[String: Any]])
+        return interactions.compactMap { $0["description"] as? String }
+    }
+}
@@ -0,0 +1,159 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class PactShardsTests: XCTestCase {
+
+    private var pactDirectory: URL!
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try Logging.initialize()
+
+        pactDirectory = FileManager.default.temporaryDirectory.appendingPathComponent("pacts-\(UUID().uuidString)", isDirectory: true)
+    }
+
+    override func tearDown() async throws {
+        try? FileManager.default.removeItem(at: pactDirectory)
+        try await super.tearDown()
+    }
+
+    // MARK: - Tests
+
+    func testShardDirectoryIsPerProcess() {
+        let directory = PactShards.directory(in: pactDirectory.path)
+
+        XCTAssertTrue(directory.hasPrefix(pactDirectory.path))
+        XCTAssertTrue(directory.hasSuffix(PactShards.shardID))
+        XCTAssertTrue(PactShards.shardID.hasPrefix("\(ProcessInfo.processInfo.processIdentifier)-"))
+    }
+
+    func testMergesShardsByInteractionDescription() throws {
+        let shardsRoot = pactDirectory.appendingPathComponent(".pact-shards")
+        try makePact(consumer: "shard-consumer", paths: ["/events", "/users"])
+            .writePactFile(directory: shardsRoot.appendingPathComponent("process-1").path)
+        try makePact(consumer: "shard-consumer", paths: ["/users", "/orders"])
+            .writePactFile(directory: shardsRoot.appendingPathComponent("process-2").path)
+        try makePact(consumer: "other-consumer", paths: ["/events"])
+            .writePactFile(directory: shardsRoot.appendingPathComponent("process-2").path)
+
+        let summary = try PactShards.merge(pactDirectory: pactDirectory.path)
+
+        XCTAssertEqual(summary.files, 2)
+        XCTAssertEqual(summary.shards, 3)
+        XCTAssertEqual(summary.interactions, 4)
+        XCTAssertEqual(try descriptions(in: "shard-consumer-shard-provider.json"), ["A request for /events", "A request for /users", "A request for /orders"])
+        XCTAssertEqual(try descriptions(in: "other-consumer-shard-provider.json"), ["A request for /events"])
+        XCTAssertFalse(FileManager.default.fileExists(atPath: shardsRoot.path))
+    }
+
+    func testMergesShardsIntoExistingPactFile() throws {
+        try makePact(consumer: "shard-consumer", paths: ["/events"]).writePactFile(directory: pactDirectory.path)
+        try makePact(consumer: "shard-consumer", paths: ["/users"]).writePactFile(directory: PactShards.directory(in: pactDirectory.path))
+
+        try PactShards.merge(pactDirectory: pactDirectory.path)
+
+        XCTAssertEqual(try descriptions(in: "shard-consumer-shard-provider.json"), ["A request for /events", "A request for /users"])
+    }
+
+    func testShardsReplaceStaleInteractionsInExistingPactFile() throws {
+        try makePact(consumer: "shard-consumer", paths: ["/events"], status: TestStatusCode.ok.rawValue)
+            .writePactFile(directory: pactDirectory.path)
+        try makePact(consumer: "shard-consumer", paths: ["/events"], status: TestStatusCode.accepted.rawValue)
+            .writePactFile(directory: PactShards.directory(in: pactDirectory.path))
+
+        try PactShards.merge(pactDirectory: pactDirectory.path)
+
+        let interactions = try interactions(in: "shard-consumer-shard-provider.json")
+        XCTAssertEqual(interactions.count, 1)
+        XCTAssertEqual((interactions.first?["response"] as? [String: Any])?["status"] as? Int, TestStatusCode.accepted.rawValue)
+    }
+
+    func testMergeKeepsInteractionsOfDifferentTypesApart() throws {
+        let existing = #"""
+        {
+          "consumer": { "name": "shard-consumer" },
+          "provider": { "name": "shard-provider" },
+          "interactions": [
+            { "type": "Asynchronous/Messages", "description": "A request for /events", "contents": { "content": "event" } }
+          ]
+        }
+        """#
+        try FileManager.default.createDirectory(at: pactDirectory, withIntermediateDirectories: true)
+        try Data(existing.utf8).write(to: pactDirectory.appendingPathComponent("shard-consumer-shard-provider.json"))
+        try makePact(consumer: "shard-consumer", paths: ["/events"]).writePactFile(directory: PactShards.directory(in: pactDirectory.path))
+
+        try PactShards.merge(pactDirectory: pactDirectory.path)
+
+        let interactions = try interactions(in: "shard-consumer-shard-provider.json")
+        XCTAssertEqual(interactions.compactMap { $0["type"] as? String }, ["Asynchronous/Messages", "Synchronous/HTTP"])
+    }
+
+    func testMergeKeepsSlashesAndNumbers() throws {
+        let existing = #"""
+        {
+          "consumer": { "name": "shard-consumer" },
+          "provider": { "name": "shard-provider" },
+          "interactions": [],
+          "metadata": { "numbers": { "integer": 3, "large": 12345678901234, "decimal": 2.5, "fraction": 0.1, "negative": -7 } }
+        }
+        """#
+        try FileManager.default.createDirectory(at: pactDirectory, withIntermediateDirectories: true)
+        try Data(existing.utf8).write(to: pactDirectory.appendingPathComponent("shard-consumer-shard-provider.json"))
+        try makePact(consumer: "shard-consumer", paths: ["/events/latest"]).writePactFile(directory: PactShards.directory(in: pactDirectory.path))
+
+        try PactShards.merge(pactDirectory: pactDirectory.path)
+
+        let data = try Data(contentsOf: pactDirectory.appendingPathComponent("shard-consumer-shard-provider.json"))
+        let contents = String(decoding: data, as: UTF8.self)
+        XCTAssertTrue(contents.contains(#""/events/latest""#))
+        XCTAssertFalse(contents.contains(#"\/"#))
+
+        let json = try XCTUnwrap(try JSONSerialization.jsonObject(with: data) as? [String: Any])
+        let numbers = try XCTUnwrap((json["metadata"] as? [String: Any])?["numbers"] as? [String: NSNumber])
+        XCTAssertEqual(numbers["integer"], 3)
+        XCTAssertEqual(numbers["large"]?.int64Value, 12_345_678_901_234)
+        XCTAssertEqual(numbers["decimal"]?.doubleValue, 2.5)
+        XCTAssertEqual(numbers["fraction"]?.doubleValue, 0.1)
+        XCTAssertEqual(numbers["negative"], -7)
+    }
+
+    func testShardedBuilderWritesToItsShard() async throws {
+        let pact = try makePact(consumer: "shard-consumer", paths: ["/events"])
+        let builder = PactBuilder(pact: pact, config: PactBuilder.Config(pactDirectory: pactDirectory.path, sharded: true))
+
+        try await builder.verify { context in
+            _ = try await URLSession(configuration: .ephemeral).data(from: context.mockServerURL.appendingPathComponent("events"))
+        }
+
+        let shardFile = URL(fileURLWithPath: PactShards.directory(in: pactDirectory.path)).appendingPathComponent(pact.filename)
+        XCTAssertTrue(FileManager.default.fileExists(atPath: shardFile.path))
+        XCTAssertFalse(FileManager.default.fileExists(atPath: pactDirectory.appendingPathComponent(pact.filename).path))
+    }
+}
+
+// MARK: - Private
+
+private extension PactShardsTests {
+
+    func makePact(consumer: String, paths: [String], status: Int = TestStatusCode.ok.rawValue) throws -> Pact {
+        try PactFixtures.pact(consumer: consumer, provider: "shard-provider", paths: paths, status: status)
+    }
+
+    func interactions(in filename: String) throws -> [[String: Any]] {
+        let data = try Data(contentsOf: pactDirectory.appendingPathComponent(filename))
+        let json = try XCTUnwrap(try JSONSerialization.jsonObject(with: data) as? [String: Any])
+        return try XCTUnwrap(json["interactions"] as? [[String: Any]])
+    }
+
+    func descriptions(in filename: String) throws -> [String] {
+        try interactions(in: filename).compactMap { $0["description"] as? String }
+    }
+}
@@ -0,0 +1,77 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class PactSuiteRunnerTests: XCTestCase {
+
+    private var pactDirectory: String {
+        NSTemporaryDirectory().appending("pacts/")
+    }
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try Logging.initialize()
+    }
+
+    // MARK: - Tests
+
+    func testDefaultConcurrencyIsBoundByProcessorCount() {
+        XCTAssertGreaterThanOrEqual(PactSuiteRunner.defaultMaxConcurrency, 1)
+        XCTAssertLessThanOrEqual(PactSuiteRunner.defaultMaxConcurrency, ProcessInfo.processInfo.activeProcessorCount)
+        XCTAssertEqual(PactSuiteRunner(maxConcurrency: 0).maxConcurrency, 1)
+    }
+
+    func testRunsJobsAndAggregatesOutcomes() async throws {
+        let jobs = try (0..<6).map { index in
+            PactSuiteRunner.Job(builder: try makeBuilder(provider: "suite-provider-\(index)")) { context in
+                let url = context.mockServerURL.appendingPathComponent("events")
+                let (_, response) = try await URLSession(configuration: .ephemeral).data(from: url)
+                XCTAssertEqual((response as? HTTPURLResponse)?.statusCode, 200)
+            }
+        }
+
+        let outcome = await PactSuiteRunner(maxConcurrency: 2).run(jobs)
+
+        XCTAssertTrue(outcome.succeeded, outcome.description)
+        XCTAssertEqual(outcome.entries.map(\.name), (0..<6).map { "suite-consumer-suite-provider-\($0).json" })
+        XCTAssertTrue(outcome.entries.allSatisfy { $0.duration > 0 })
+    }
+
+    func testReportsFailedJobs() async throws {
+        let jobs = [
+            PactSuiteRunner.Job(name: "passing", builder: try makeBuilder(provider: "suite-passing")) { context in
+                _ = try await URLSession(configuration: .ephemeral).data(from: context.mockServerURL.appendingPathComponent("events"))
+            },
+            PactSuiteRunner.Job(name: "missing request", builder: try makeBuilder(provider: "suite-failing")) { _ in },
+        ]
+
+        let outcome = await PactSuiteRunner().run(jobs)
+
+        XCTAssertFalse(outcome.succeeded)
+        XCTAssertEqual(outcome.failures.map(\.name), ["missing request"])
+    }
+}
+
+// MARK: - Private
+
+private extension PactSuiteRunnerTests {
+
+    func makeBuilder(provider: String) throws -> PactBuilder {
+        let pact = try Pact(consumer: "suite-consumer", provider: provider).withSpecification(.v4)
+        let builder = PactBuilder(pact: pact, config: PactBuilder.Config(pactDirectory: pactDirectory))
+
+        try builder
+            .uponReceiving("A request for events")
+            .withRequest(method: .GET, path: "/events")
+            .willRespond(with: 200)
+
+        return builder
+    }
+}
@@ -0,0 +1,131 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+import XCTest
+
+final class PluginLogCollectorTests: XCTestCase {
+
+    override func setUp() async throws {
+        try await super.setUp()
+        try Logging.initialize()
+    }
+
+    // MARK: - Ring buffer
+
+    func testRingBufferDrainsInOrderAndDropsWhenFull() {
+        let ring = RingBuffer<Int>(capacity: 3)
+
+        XCTAssertEqual((0..<5).map { ring.push($0) }, [true, true, true, false, false])
+        XCTAssertEqual(ring.drain(), [0, 1, 2])
+        XCTAssertEqual(ring.dropped, 2)
+
+        ring.push(5)
+        ring.push(6)
+        XCTAssertEqual(ring.drain(), [5, 6])
+        XCTAssertEqual(ring.drain(), [])
+    }
+
+    func testRingBufferAcceptsConcurrentProducers() {
+        let ring = RingBuffer<Int>(capacity: 1_000)
+
+        DispatchQueue.concurrentPerform(iterations: 8) { producer in
+            for index in 0..<200 {
+                ring.push(producer * 1_000 + index)
+            }
+        }
+
+        XCTAssertEqual(ring.drain().count, 1_000)
+        XCTAssertEqual(ring.dropped, 600)
+    }
+
+    // MARK: - Collector
+
+    func testDeliversRecordsOfWatchedInstances() {
+        let delivered = Delivered()
+        let collector = PluginLogCollector { delivered.append($0) }
+        collector.watch(pluginInstanceID: "plugin-1")
+
+        collector.ingest([#"{"message":"one"}"#, #"{"message":"two"}"#], pluginInstanceID: "plugin-1")
+        collector.ingest([#"{"message":"other"}"#], pluginInstanceID: "plugin-2")
+        collector.flush()
+
+        XCTAssertEqual(delivered.records.map(\.json), [#"{"message":"one"}"#, #"{"message":"two"}"#])
+        XCTAssertEqual(delivered.records.map(\.pluginInstanceID), ["plugin-1", "plugin-1"])
+        XCTAssertEqual(collector.statistics, PluginLogCollector.Statistics(received: 2, delivered: 2, dropped: 0, filtered: 1))
+    }
+
+    func testCountsRecordsDroppedWhileHandlerIsBusy() {
+        let entered = DispatchSemaphore(value: 0)
+        let release = DispatchSemaphore(value: 0)
+        let collector = PluginLogCollector(capacity: 4) { _ in
+            entered.signal()
+            release.wait()
+        }
+        collector.watch(pluginInstanceID: "plugin-1")
+
+        // The first record is delivered and blocks the handler; the rest queue up behind it.
+        collector.ingest(["0"], pluginInstanceID: "plugin-1")
+        entered.wait()
+        collector.ingest((1...10).map(String.init), pluginInstanceID: "plugin-1")
+
+        for _ in 0..<11 {
+            release.signal()
+        }
+        collector.flush()
+
+        XCTAssertEqual(collector.statistics.received, 11)
+        XCTAssertEqual(collector.statistics.dropped, 6)
+        XCTAssertEqual(collector.statistics.delivered, 5)
+    }
+
+    func testReadsOnlyEntriesPastTheReadOffset() {
+        let log = Array("{\"message\":\"one\"}\n{\"message\":\"two\"}\n".utf8)
+
+        log.withUnsafeBufferPointer { log in
+            XCTAssertEqual(PluginLogCollector.entries(in: log, after: 0), [#"{"message":"one"}"#, #"{"message":"two"}"#])
+            XCTAssertEqual(PluginLogCollector.entries(in: log, after: 18), [#"{"message":"two"}"#])
+            XCTAssertEqual(PluginLogCollector.entries(in: log, after: log.count), [])
+            XCTAssertEqual(PluginLogCollector.entries(in: log, after: log.count + 1), [])
+        }
+    }
+
+    func testPollingUnknownInstanceCollectsNothing() {
+        let delivered = Delivered()
+        let collector = PluginLogCollector { delivered.append($0) }
+        collector.watch(pluginInstanceID: UUID().uuidString)
+
+        collector.start()
+        collector.flush()
+        collector.stop()
+
+        XCTAssertTrue(delivered.records.isEmpty)
+        XCTAssertEqual(collector.statistics.received, 0)
+    }
+}
+
+// MARK: - Private
+
+private final class Delivered: @unchecked Sendable {
+    private let lock = NSLock()
+    private var delivered: [PluginLogCollector.Record] = []
+
+    var records: [PluginLogCollector.Record] {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return delivered
+    }
+
+    func append(_ records: [PluginLogCollector.Record]) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        delivered.append(contentsOf: records)
+    }
+}
@@ -0,0 +1,68 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+import XCTest
+
+/// Counts the Swift heap allocations made on the calling thread.
+///
+/// Hooks the Swift runtime's `_swift_allocObject` entry point, through which every class instance and the
+/// storage of every array, dictionary and non-small string is allocated. Allocations made by C code,
+/// such as the Pact core's own, are not counted.
+enum AllocationCounter {
+
+    private typealias AllocObject = @convention(c) (UnsafeRawPointer, Int, Int) -> UnsafeMutableRawPointer
+
+    /// The number of Swift heap allocations `body` made on the calling thread.
+    ///
+    /// - Throws: `XCTSkip` if the Swift runtime does not expose the allocation hook, or the error thrown by `body`.
+    ///
+    static func count(_ body: () throws -> Void) throws -> Int {
+        guard let symbol = dlsym(defaultHandle, "_swift_allocObject") else {
+            throw XCTSkip("The Swift runtime does not export _swift_allocObject, so allocations can not be counted")
+        }
+
+        let hook = symbol.assumingMemoryBound(to: AllocObject?.self)
+        guard let original = hook.pointee else {
+            throw XCTSkip("The Swift runtime's _swift_allocObject hook is not set, so allocations can not be counted")
+        }
+
+        originalAllocObject = original
+        countingThread = pthread_self()
+        allocations = 0
+        hook.pointee = countingAllocObject
+        defer {
+            hook.pointee = original
+            countingThread = nil
+        }
+
+        try body()
+        return allocations
+    }
+}
+
+// MARK: - Private
+
+#if os(Linux)
+private let defaultHandle: UnsafeMutableRawPointer? = nil
+#else
+private let defaultHandle = UnsafeMutableRawPointer(bitPattern: -2) // RTLD_DEFAULT
+#endif
+
+private var originalAllocObject: (@convention(c) (UnsafeRawPointer, Int, Int) -> UnsafeMutableRawPointer)?
+private var countingThread: pthread_t?
+private var allocations = 0
+
+private let countingAllocObject: @convention(c) (UnsafeRawPointer, Int, Int) -> UnsafeMutableRawPointer = { metadata, size, alignMask in
+    if let thread = countingThread, pthread_equal(thread, pthread_self()) != 0 {
+        allocations += 1
+    }
+    guard let original = originalAllocObject else {
+        fatalError("The allocation hook must only be installed by AllocationCounter")
+    }
+    return original(metadata, size, alignMask)
+}
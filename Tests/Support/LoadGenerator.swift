@@ -0,0 +1,99 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+import Foundation
+
+/// Drives a URL with concurrent clients for a fixed duration and records each request's latency.
+enum LoadGenerator {
+
+    struct Report: CustomStringConvertible {
+        let label: String
+        let clients: Int
+        let duration: TimeInterval
+        let errors: Int
+
+        /// Latencies of the successful requests in nanoseconds, sorted ascending.
+        let latencies: [UInt64]
+
+        var requestsPerSecond: Double {
+            Double(latencies.count) / duration
+        }
+
+        /// The latency at `percentile` (0...1) in milliseconds.
+        func latency(atPercentile percentile: Double) -> Double {
+            guard latencies.isEmpty == false else {
+                return 0
+            }
+            let index = min(latencies.count - 1, Int((Double(latencies.count) * percentile).rounded(.up)) - 1)
+            return Double(latencies[max(0, index)]) / 1_000_000
+        }
+
+        var description: String {
+            String(
+                format: "%@: %d clients, %.0f req/s, p50 %.3fms, p99 %.3fms, p999 %.3fms, %d requests, %d errors",
+                label,
+                clients,
+                requestsPerSecond,
+                latency(atPercentile: 0.5),
+                latency(atPercentile: 0.99),
+                latency(atPercentile: 0.999),
+                latencies.count,
+                errors
+            )
+        }
+    }
+
+    /// Sends `request` from `clients` concurrent clients, each waiting for a response before sending the next request.
+    static func run(
+        label: String,
+        request: URLRequest,
+        session: URLSession,
+        clients: Int,
+        duration: TimeInterval
+    ) async -> Report {
+        let start = DispatchTime.now().uptimeNanoseconds
+        let deadline = start + UInt64(duration * 1_000_000_000)
+
+        let results = await withTaskGroup(of: (latencies: [UInt64], errors: Int).self) { group in
+            for _ in 0..<clients {
+                group.addTask {
+                    var latencies: [UInt64] = []
+                    var errors = 0
+                    while DispatchTime.now().uptimeNanoseconds < deadline {
+                        let requestStart = DispatchTime.now().uptimeNanoseconds
+                        do {
+                            let (_, response) = try await session.data(for: request)
+                            guard (response as? HTTPURLResponse)?.statusCode == 200 else {
+                                errors += 1
+                                continue
+                            }
+                            latencies.append(DispatchTime.now().uptimeNanoseconds - requestStart)
+                        } catch {
+                            errors += 1
+                        }
+                    }
+                    return (latencies, errors)
+                }
+            }
+
+            var results: [(latencies: [UInt64], errors: Int)] = []
+            for await result in group {
+                results.append(result)
+            }
+            return results
+        }
+
+        let elapsed = Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000_000
+        return Report(
+            label: label,
+            clients: clients,
+            duration: elapsed,
+            errors: results.reduce(0) { $0 + $1.errors },
+            latencies: results.flatMap(\.latencies).sorted()
+        )
+    }
+}
@@ -14,9 +14,32 @@ final class MockPactFFIProvider: PactFFIProviding {
 
     private(set) var _returnNil: Bool = false
     private(set) var specVersion: Pact.Specification = .v3
+    private(set) var tlsCACertificateCallCount = 0
+    private let lock = NSLock()
+    private var _requestedPorts: [Int32] = []
+    private var _cleanupCallCount = 0
+    private var mismatchesBuffer: UnsafeMutableBufferPointer<UInt8>?
 
     let subject = PassthroughSubject<String, Never>()
 
+    deinit {
+        mismatchesBuffer?.deallocate()
+    }
+
+    var requestedPorts: [Int32] {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return _requestedPorts
+    }
+
+    var cleanupCallCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+
+        return _cleanupCallCount
+    }
+
     func returnNil(_ bool: Bool) {
         _returnNil = bool
     }
@@ -50,7 +73,11 @@ final class MockPactFFIProvider: PactFFIProviding {
         port: Int32,
         transferProtocol: PactSwiftMockServer.MockServer.TransferProtocol
     ) throws -> Int32 {
-        21_337
+        lock.lock()
+        defer { lock.unlock() }
+
+        _requestedPorts.append(port)
+        return 21_337
     }
 
     func mockServerMatched(port: Int32) -> Bool {
@@ -61,20 +88,40 @@ final class MockPactFFIProvider: PactFFIProviding {
         _returnNil ? nil : Self.mockServerMismatchesString
     }
 
+    func mockServerMismatchesBuffer(port: Int32) -> UnsafeBufferPointer<UInt8>? {
+        guard _returnNil == false else {
+            return nil
+        }
+
+        if let mismatchesBuffer = mismatchesBuffer {
+            return UnsafeBufferPointer(mismatchesBuffer)
+        }
+        let bytes = Array(Self.mockServerMismatchesString.utf8)
+        let buffer = UnsafeMutableBufferPointer<UInt8>.allocate(capacity: bytes.count)
+        _ = buffer.initialize(from: bytes)
+        mismatchesBuffer = buffer
+        return UnsafeBufferPointer(buffer)
+    }
+
     func mockServerLogs(port: Int32) -> String? {
         _returnNil ? nil : "mock-server-logs"
     }
 
-    func mockServerCleanup(port: Int32) -> Bool {
-        false
+    func mockServerLogsLength(port: Int32) -> Int? {
+        mockServerLogs(port: port)?.utf8.count
     }
 
-    func tlsCACertificate() -> String? {
-        _returnNil ? nil : "mock-tls-ca-cert"
+    func mockServerCleanup(port: Int32) -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+
+        _cleanupCallCount += 1
+        return false
     }
 
-    func stringRelease(cert: String) {
-        // no-op
+    func tlsCACertificate() -> String? {
+        tlsCACertificateCallCount += 1
+        return _returnNil ? nil : "mock-tls-ca-cert"
     }
 
     func newPact(consumer: String, provider: String) -> PactHandle {
@@ -125,6 +172,21 @@ final class MockPactFFIProvider: PactFFIProviding {
         throw MockPactFFIProviderError.notImplemented
     }
 
+    func withBinaryFile(handle: InteractionHandle, body: Data, contentType: String, interactionPart: InteractionPart) throws {
+        throw MockPactFFIProviderError.notImplemented
+    }
+
+    func withMultipartFile(
+        handle: InteractionHandle,
+        path: String,
+        partName: String,
+        contentType: String,
+        boundary: String?,
+        interactionPart: InteractionPart
+    ) throws {
+        throw MockPactFFIProviderError.notImplemented
+    }
+
     func withBody(handle: InteractionHandle, body: Data, contentType: String, interactionPart: InteractionPart) throws {
         guard let bodyString = String(data: body, encoding: .utf8) else {
             throw MockPactFFIProviderError.preconditionFailure("Failed to cast 'body: Data' to String...")
@@ -132,6 +194,10 @@ final class MockPactFFIProvider: PactFFIProviding {
         subject.send(bodyString)
     }
 
+    func withBody(handle: InteractionHandle, body: MatchingBody, contentType: String, interactionPart: InteractionPart) throws {
+        subject.send(body.json)
+    }
+
     func withStatus(handle: InteractionHandle, status: Int) throws {
         throw MockPactFFIProviderError.notImplemented
     }
@@ -148,6 +214,10 @@ final class MockPactFFIProvider: PactFFIProviding {
         throw MockPactFFIProviderError.notImplemented
     }
 
+    func apply(_ spec: CompiledInteractionSpec, handle: InteractionHandle) throws {
+        throw MockPactFFIProviderError.notImplemented
+    }
+
     func generateString(regex: String) -> String? {
         nil
     }
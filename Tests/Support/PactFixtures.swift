@@ -0,0 +1,33 @@
+//
+//  Created by Marko Justinek on 17/10/2026.
+//  Copyright © 2026 Marko Justinek. All rights reserved.
+//
+//  See LICENSE file for licensing information.
+//
+
+@testable import PactSwiftMockServer
+
+/// Builds the Pacts the tests start mock servers for, write and merge.
+enum PactFixtures {
+
+    /// A V4 Pact with a `GET` interaction for each of `paths`, described as "A request for `path`".
+    static func pact(consumer: String, provider: String, paths: [String], status: Int = TestStatusCode.ok.rawValue) throws -> Pact {
+        let pact = try Pact(consumer: consumer, provider: provider).withSpecification(.v4)
+        try addInteractions(paths: paths, status: status) { pact.uponReceiving($0) }
+
+        return pact
+    }
+
+    /// Adds a `GET` interaction for each of `paths`, described as "A request for `path`", through `uponReceiving`.
+    static func addInteractions(
+        paths: [String],
+        status: Int = TestStatusCode.ok.rawValue,
+        uponReceiving: (String) -> Interaction
+    ) throws {
+        for path in paths {
+            try uponReceiving("A request for \(path)")
+                .withRequest(method: .GET, path: path)
+                .willRespond(with: status)
+        }
+    }
+}